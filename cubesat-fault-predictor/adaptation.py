@@ -0,0 +1,177 @@
+'''
+This script supports the firmware's on-board adaptation of the output
+layer (core/Src/app/ml_adaptation.c):
+- it generates the per-class anchors the firmware trains on alongside the
+  ground-labelled faults (firmware/core/Src/app/ml_adaptation_anchors.c)
+- it replays the same update under injected sensor drift, with the
+  constants read from ml_adaptation.h, and compares the frozen network
+  with the adapted one
+
+Inputs take the firmware's path: feature_schema's float32 features,
+standardised with the scaler compiled into feature_schema.h, as
+feature_engine_standardise does before both the classifier and
+ml_adaptation_note_fault.
+
+The drift is a slow ramp: current draw up 0.25 A, bus voltage down 0.06 V
+and the MCU 15 C warmer, as an ageing panel and a degrading thermal path
+would do. Only faults the classifier raises get labelled, as in flight.
+
+Rerun after retraining the network or changing ML_ADAPT_*.
+'''
+import numpy as np
+import pandas as pd
+import os
+import re
+import sys
+from feature_schema import read_scaler, standardise, training_split
+
+# Configuration
+DATA_FILE_PATH = "data/cubesat_data.csv"
+FIRMWARE_DIR = os.path.join("..", "firmware")
+WEIGHTS_PATH = os.path.join(FIRMWARE_DIR, "core", "Src", "network_data_params.c")
+HEADER_PATH = os.path.join(FIRMWARE_DIR, "core", "Inc", "app", "ml_adaptation.h")
+ANCHORS_PATH = os.path.join(FIRMWARE_DIR, "core", "Src", "app", "ml_adaptation_anchors.c")
+
+# Full drift, reached after DRIFT_RAMP of the SIMULATED samples
+DRIFT_CURRENT = 0.25
+DRIFT_VOLTAGE = -0.06
+DRIFT_TEMPERATURE = 15.0
+DRIFT_RAMP = 4000
+SIMULATED = 6000
+# As ML_DECISION_CONFIDENCE in ml_integration.h
+DECISION_CONFIDENCE = 0.7
+
+sys.path.insert(0, os.path.join(FIRMWARE_DIR, "tools"))
+from golden_vector import floats, read_weights  # noqa: E402
+
+def read_constants(path=HEADER_PATH):
+    with open(path) as f:
+        text = f.read()
+
+    def value(name):
+        match = re.search(rf"#define {name} ([0-9.]+)f?\b", text)
+        if not match:
+            raise ValueError(f"{name} not found in {path}")
+        return float(match.group(1))
+
+    return {
+        'replay': int(value("ML_ADAPT_REPLAY_PER_CLASS")),
+        'epochs': int(value("ML_ADAPT_EPOCHS")),
+        'learning_rate': value("ML_ADAPT_LEARNING_RATE"),
+        'max_delta': value("ML_ADAPT_MAX_DELTA"),
+    }
+
+class FirmwareNetwork:
+    '''The fault_model network from the firmware's weights blob.'''
+
+    def __init__(self, path=WEIGHTS_PATH):
+        blob = read_weights(path)
+        self.w0 = np.array(floats(blob, 0, 16 * 8), np.float32).reshape(16, 8)
+        self.b0 = np.array(floats(blob, 512, 16), np.float32)
+        self.w1 = np.array(floats(blob, 576, 8 * 16), np.float32).reshape(8, 16)
+        self.b1 = np.array(floats(blob, 1088, 8), np.float32)
+        self.w2 = np.array(floats(blob, 1120, 5 * 8), np.float32).reshape(5, 8)
+        self.b2 = np.array(floats(blob, 1280, 5), np.float32)
+
+    def features(self, X):
+        '''Output of the second hidden layer, as fault_model_kernel_features.'''
+        h = np.maximum(0, X @ self.w0.T + self.b0)
+        return np.maximum(0, h @ self.w1.T + self.b1)
+
+def softmax(H, weights, bias):
+    z = H @ weights.T + bias
+    z -= z.max(axis=1, keepdims=True)
+    e = np.exp(z)
+    return e / e.sum(axis=1, keepdims=True)
+
+def drift(X, k):
+    X = X.copy()
+    X[:, 0] += k * DRIFT_VOLTAGE
+    X[:, 1] += k * DRIFT_CURRENT
+    X[:, 2] = X[:, 0] * X[:, 1]
+    X[:, 3] += k * DRIFT_TEMPERATURE
+    return X
+
+def write_anchors(anchors, path=ANCHORS_PATH):
+    with open(path, 'w') as f:
+        f.write("// Generated by cubesat-fault-predictor/adaptation.py - do not edit,\n")
+        f.write("// rerun it after retraining\n")
+        f.write("#include \"ml_adaptation.h\"\n\n")
+        f.write("const float ml_adaptation_anchors[FAULT_MODEL_OUTPUTS][FAULT_MODEL_INPUTS] = {\n")
+        for row in anchors:
+            f.write("    {" + ", ".join(f"{v:.7e}f" for v in row) + "},\n")
+        f.write("};\n")
+    print(f"Anchors saved to {path}")
+
+class Adaptation:
+    '''ml_adaptation_label on the host: same replay, order and clamp.'''
+
+    def __init__(self, network, anchors, constants):
+        self.network = network
+        self.c = constants
+        self.anchors = network.features(anchors)
+        self.weights = network.w2.copy()
+        self.bias = network.b2.copy()
+        self.replay = {c: [] for c in range(len(anchors))}
+
+    def step(self, h, label):
+        g = softmax(h[None], self.weights, self.bias)[0]
+        g[label] -= 1.0
+        self.weights -= self.c['learning_rate'] * np.outer(g, h)
+        self.bias -= self.c['learning_rate'] * g
+        delta = self.c['max_delta']
+        self.weights = np.clip(self.weights, self.network.w2 - delta, self.network.w2 + delta)
+        self.bias = np.clip(self.bias, self.network.b2 - delta, self.network.b2 + delta)
+
+    def label(self, h, label):
+        self.replay[label] = (self.replay[label] + [h])[-self.c['replay']:]
+        for _ in range(self.c['epochs']):
+            for c, anchor in enumerate(self.anchors):
+                self.step(anchor, c)
+            for c, held in self.replay.items():
+                for sample in held:
+                    self.step(sample, c)
+
+def simulate(network, scaler, anchors, constants, X_train, y_train, X_test, y_test):
+    adaptation = Adaptation(network, anchors, constants)
+    rng = np.random.default_rng(1)
+    labels = corrected = 0
+
+    print(f"{'samples':>8} {'drift':>6} {'frozen':>7} {'adapted':>8} {'labels':>7} {'corrected':>10}")
+    for n, i in enumerate(rng.integers(0, len(X_train), SIMULATED)):
+        k = min(1.0, n / DRIFT_RAMP)
+        h = network.features(standardise(drift(X_train[i:i + 1], k), scaler))[0]
+        p = softmax(h[None], adaptation.weights, adaptation.bias)[0]
+        predicted = int(p.argmax())
+
+        # Only what the classifier raised reaches the ground
+        if predicted != 0 and p[predicted] > DECISION_CONFIDENCE:
+            labels += 1
+            corrected += int(y_train[i] != predicted)
+            adaptation.label(h, int(y_train[i]))
+
+        if (n + 1) % 1000 == 0:
+            H = network.features(standardise(drift(X_test, k), scaler))
+            frozen = np.mean(softmax(H, network.w2, network.b2).argmax(1) == y_test)
+            adapted = np.mean(softmax(H, adaptation.weights, adaptation.bias).argmax(1) == y_test)
+            print(f"{n + 1:>8} {k:>6.2f} {frozen:>7.3f} {adapted:>8.3f} {labels:>7} {corrected:>10}")
+
+    H = network.features(standardise(X_test, scaler))
+    clean = np.mean(softmax(H, adaptation.weights, adaptation.bias).argmax(1) == y_test)
+    largest = max(np.max(np.abs(adaptation.weights - network.w2)),
+                  np.max(np.abs(adaptation.bias - network.b2)))
+    print(f"Adapted network on undrifted data: {clean:.3f}, largest change {largest:.3f}")
+
+if __name__ == "__main__":
+    df = pd.read_csv(DATA_FILE_PATH)
+    # Same split as train_model.py, the scaler the firmware was built with
+    X_train, X_test, y_train, y_test = training_split(df)
+    scaler = read_scaler()
+
+    standardised = standardise(X_train, scaler)
+    anchors = np.array([standardised[y_train == c].mean(axis=0, dtype=np.float64)
+                        for c in np.unique(y_train)], dtype=np.float32)
+    write_anchors(anchors)
+
+    simulate(FirmwareNetwork(), scaler, anchors, read_constants(),
+             X_train, y_train, X_test, y_test)
@@ -0,0 +1,64 @@
+'''
+This script checks the firmware's interrupt-level rules
+(firmware/core/Inc/app/fast_rules.h) against the dataset: every rule has
+to catch its whole class and nothing else, or it would raise faults the
+network would not. What no rule claims is left to the network.
+
+Rerun after changing generate_data.py or the FAST_RULE_* thresholds.
+'''
+import pandas as pd
+import os
+import re
+import sys
+
+# Configuration
+DATA_FILE_PATH = "data/cubesat_data.csv"
+HEADER_PATH = os.path.join("..", "firmware", "core", "Inc", "app", "fast_rules.h")
+
+CLASS_NAMES = {
+    0: "Normal",
+    1: "OBC - No heartbeat",
+    2: "OBC - Overcurrent",
+    3: "TTC - UART timeout",
+    4: "TTC - Data corruption",
+}
+
+def read_corruption_errors(path=HEADER_PATH):
+    with open(path) as f:
+        match = re.search(r"#define FAST_RULE_CORRUPTION_ERRORS (\d+)", f.read())
+    if not match:
+        raise ValueError(f"FAST_RULE_CORRUPTION_ERRORS not found in {path}")
+    return int(match.group(1))
+
+def rules(corruption_errors):
+    '''(fault class, what the firmware watches, sample test) per rule.'''
+    return [
+        (1, "no PC13 edge for HEARTBEAT_TIMEOUT_MS", lambda df: df['heartbeat_signal'] == 0),
+        (3, "repeated USART1 receiver timeouts", lambda df: df['uart_timeout'] == 1),
+        (4, f"{corruption_errors} line or CRC errors in the window",
+         lambda df: df['crc_error_count'] >= corruption_errors),
+    ]
+
+def check_rules(df, corruption_errors):
+    claimed = pd.Series(False, index=df.index)
+    ok = True
+
+    print(f"{'class':<24} {'rule':<40} {'caught':>8} {'false':>6}")
+    for fault_class, source, test in rules(corruption_errors):
+        hit = test(df)
+        own = df['fault'] == fault_class
+        caught = (hit & own).sum() / own.sum()
+        false = (hit & ~own).sum()
+        claimed |= hit
+        ok &= caught == 1.0 and false == 0
+        print(f"{CLASS_NAMES[fault_class]:<24} {source:<40} {caught:>8.2%} {false:>6}")
+
+    left = df[~claimed]
+    print(f"Left to the network: {len(left)} of {len(df)} samples, classes "
+          + ", ".join(f"{c} ({n})" for c, n in left['fault'].value_counts().sort_index().items()))
+    return ok
+
+if __name__ == "__main__":
+    df = pd.read_csv(DATA_FILE_PATH)
+    if not check_rules(df, read_corruption_errors()):
+        sys.exit("a rule misses part of its class or raises another one")
@@ -0,0 +1,314 @@
+'''
+The feature schema shared by the training pipeline and the firmware.
+
+Each sensor channel is sampled once per inference period and kept over a
+sliding window of its own length. Per channel the firmware's feature
+engine (firmware/core/Src/app/feature_engine.c) tracks, with O(1) work
+per sample:
+- value: the latest sample
+- mean and variance
+- slope: least-squares fit over the window, per second
+- min and max
+- crossings: times neighbouring samples sit on either side of the
+  channel's reference level
+- rate: newest minus oldest sample, per second
+
+MODEL_INPUTS picks what the network sees, in input order. FeatureEngine
+below is the same arithmetic in float32, operation for operation, so
+features computed here for training match the firmware bit for bit;
+tools/feature_engine_bench.c checks that.
+
+The classifier was trained on standardised inputs, so the header also
+carries the training scaler's mean and deviation per input and the
+firmware applies them, in float32 as standardise() does, to the
+classifier's input only. The novelty forest, the cascade gate and the
+inference cache work on raw units.
+
+Windowed statistics only mean something on samples in acquisition order.
+The rows of data/cubesat_data.csv are independent snapshots, so the
+network in flight uses values only.
+
+Run it to regenerate firmware/core/Inc/app/feature_schema.h after
+changing the schema or the dataset (train_model.py also rewrites it with
+the scaler it trained with), or with --compare to check the firmware
+engine's output on the dataset.
+'''
+import argparse
+import numpy as np
+import os
+import re
+import struct
+import sys
+
+HEADER_PATH = os.path.join("..", "firmware", "core", "Inc", "app", "feature_schema.h")
+DATA_FILE_PATH = "data/cubesat_data.csv"
+
+# As osDelay in ml_inference_task
+SAMPLE_PERIOD_MS = 100
+
+# (name, window in samples, reference level, resolution), in the order of
+# the dataset's columns. Windows stay within 2..255 samples. Crossings are
+# counted against the level: for the analogue channels it is the nominal
+# value in generate_data.py, for the flags and counters the midpoint
+# between their nominal and fault values (packets: 95..99 against 0 on a
+# timeout, CRC errors: 0..1 against 5..19). The resolution is the
+# smallest step the sensor reports, which the firmware's inference cache
+# quantises to.
+#
+# uart_packets_received and crc_error_count are counts per one-second
+# sample window, as in the dataset; the firmware counts them over its
+# last second of samples.
+CHANNELS = (
+    ('bus_voltage', 16, 5.0, 0.01),
+    ('current_draw', 16, 0.5, 0.001),
+    ('power_consumption', 16, 2.5, 0.01),
+    ('mcu_core_temp', 32, 35.0, 0.5),
+    ('heartbeat_signal', 8, 0.5, 1.0),
+    ('uart_packets_received', 8, 50.0, 1.0),
+    ('crc_error_count', 8, 2.5, 1.0),
+    ('uart_timeout', 8, 0.5, 1.0),
+)
+
+# Same order as feature_stat_t in feature_engine.h
+STATS = ('value', 'mean', 'variance', 'slope', 'min', 'max', 'crossings', 'rate')
+
+FEATURES = [name for name, _, _, _ in CHANNELS]
+
+# (channel, statistic) per network input
+MODEL_INPUTS = tuple((name, 'value') for name in FEATURES)
+
+F32 = np.float32
+
+class ChannelWindow:
+    def __init__(self, window, level):
+        self.window = window
+        self.level = F32(level)
+        self.samples = [F32(0.0)] * window     # Shifted by the level
+        self.min_queue = []                     # Ring positions
+        self.max_queue = []
+        self.head = 0
+        self.count = 0
+        self.crossings = 0
+        self.last = F32(0.0)
+        self.sum = F32(0.0)
+        self.sum_squares = F32(0.0)
+        self.sum_index = F32(0.0)
+
+    @staticmethod
+    def crosses(a, b):
+        return (a >= 0) != (b >= 0)
+
+    def push(self, value):
+        value = F32(value)
+        x = F32(value - self.level)
+        n = self.window
+        self.last = value
+
+        if self.count == n:
+            old = self.samples[self.head]
+            if self.crosses(old, self.samples[(self.head + 1) % n]):
+                self.crossings -= 1
+            self.sum_index = F32(F32(self.sum_index - F32(self.sum - old)) + F32(F32(n - 1) * x))
+            self.sum = F32(F32(self.sum - old) + x)
+            self.sum_squares = F32(F32(self.sum_squares - F32(old * old)) + F32(x * x))
+            if self.min_queue and self.min_queue[0] == self.head:
+                self.min_queue.pop(0)
+            if self.max_queue and self.max_queue[0] == self.head:
+                self.max_queue.pop(0)
+        else:
+            self.sum_index = F32(self.sum_index + F32(F32(self.count) * x))
+            self.sum = F32(self.sum + x)
+            self.sum_squares = F32(self.sum_squares + F32(x * x))
+            self.count += 1
+
+        if self.count > 1 and self.crosses(self.samples[(self.head + n - 1) % n], x):
+            self.crossings += 1
+
+        self.samples[self.head] = x
+        while self.min_queue and self.samples[self.min_queue[-1]] >= x:
+            self.min_queue.pop()
+        self.min_queue.append(self.head)
+        while self.max_queue and self.samples[self.max_queue[-1]] <= x:
+            self.max_queue.pop()
+        self.max_queue.append(self.head)
+
+        self.head = (self.head + 1) % n
+
+        # Rounding in the running sums is dropped once per window
+        if self.head == 0:
+            self.sum = F32(0.0)
+            self.sum_squares = F32(0.0)
+            self.sum_index = F32(0.0)
+            for i in range(n):
+                v = self.samples[i]
+                self.sum = F32(self.sum + v)
+                self.sum_squares = F32(self.sum_squares + F32(v * v))
+                self.sum_index = F32(self.sum_index + F32(F32(i) * v))
+
+    def stat(self, name):
+        n = self.count
+        period = F32(F32(SAMPLE_PERIOD_MS) / F32(1000.0))
+        if n == 0:
+            return F32(0.0)
+        newest = self.samples[(self.head + self.window - 1) % self.window]
+        oldest = self.samples[(self.head + self.window - n) % self.window]
+
+        if name == 'value':
+            return self.last
+        if name == 'mean':
+            return F32(self.level + F32(self.sum / F32(n)))
+        if name == 'variance':
+            mean = F32(self.sum / F32(n))
+            variance = F32(F32(self.sum_squares / F32(n)) - F32(mean * mean))
+            return max(variance, F32(0.0))
+        if name == 'slope':
+            if n < 2:
+                return F32(0.0)
+            index_sum = n * (n - 1) // 2
+            denominator = n * ((n - 1) * n * (2 * n - 1) // 6) - index_sum * index_sum
+            numerator = F32(F32(F32(n) * self.sum_index) - F32(F32(index_sum) * self.sum))
+            return F32(F32(numerator / F32(denominator)) / period)
+        if name == 'min':
+            return F32(self.samples[self.min_queue[0]] + self.level)
+        if name == 'max':
+            return F32(self.samples[self.max_queue[0]] + self.level)
+        if name == 'crossings':
+            return F32(self.crossings)
+        if name == 'rate':
+            if n < 2:
+                return F32(0.0)
+            return F32(F32(newest - oldest) / F32(F32(n - 1) * period))
+        raise ValueError(f"unknown statistic {name}")
+
+class FeatureEngine:
+    def __init__(self):
+        self.channels = {name: ChannelWindow(window, level) for name, window, level, _ in CHANNELS}
+
+    def push(self, sample):
+        for name, value in zip(FEATURES, sample):
+            self.channels[name].push(value)
+
+    def stat(self, channel, name):
+        return self.channels[channel].stat(name)
+
+    def model_input(self):
+        return [self.stat(channel, name) for channel, name in MODEL_INPUTS]
+
+def feature_matrix(df):
+    '''
+    MODEL_INPUTS for every row of df, fed to one engine in row order. The
+    float32 results come back as float64, exactly, for the scalers to fit
+    in double precision as before.
+    '''
+    if all(name == 'value' for _, name in MODEL_INPUTS):
+        # Nothing windowed: the samples themselves
+        return df[[channel for channel, _ in MODEL_INPUTS]].values.astype(np.float64)
+
+    engine = FeatureEngine()
+    rows = []
+    for sample in df[FEATURES].values:
+        engine.push(sample)
+        rows.append(engine.model_input())
+    return np.array(rows, dtype=np.float64)
+
+def training_split(df):
+    '''The network inputs of df split as train_model.py splits them.'''
+    from sklearn.model_selection import train_test_split
+
+    y = df['fault'].values
+    return train_test_split(feature_matrix(df), y, test_size=0.2, random_state=42, stratify=y)
+
+def fit_scaler(df):
+    '''The scaler train_model.py fits, on the training part of df.'''
+    from sklearn.preprocessing import StandardScaler
+
+    X_train, _, _, _ = training_split(df)
+    return StandardScaler().fit(X_train)
+
+def read_scaler(path=HEADER_PATH):
+    '''Mean and deviation per model input, as float32, from the header.'''
+    pattern = re.compile(r"X\(\w+, [A-Z]+, (\S+)f, (\S+)f\)")
+    with open(path) as f:
+        pairs = [(F32(m.group(1)), F32(m.group(2))) for m in map(pattern.search, f) if m]
+    if len(pairs) != len(MODEL_INPUTS):
+        raise ValueError(f"{path} has {len(pairs)} scaled inputs, the schema {len(MODEL_INPUTS)}")
+    mean, scale = zip(*pairs)
+    return np.array(mean, dtype=F32), np.array(scale, dtype=F32)
+
+def standardise(X, scaler):
+    '''
+    The classifier's input as feature_engine_standardise computes it:
+    (feature - mean) / deviation in float32, from read_scaler().
+    '''
+    mean, scale = scaler
+    return (np.asarray(X, dtype=F32) - mean) / scale
+
+def write_header(scaler, path=HEADER_PATH):
+    for name, window, _, resolution in CHANNELS:
+        if not 2 <= window <= 255:
+            raise ValueError(f"{name}: window of {window} samples is outside 2..255")
+        if resolution <= 0:
+            raise ValueError(f"{name}: resolution must be positive")
+    for channel, name in MODEL_INPUTS:
+        if channel not in FEATURES or name not in STATS:
+            raise ValueError(f"unknown model input {channel}.{name}")
+
+    with open(path, 'w') as f:
+        f.write("// Generated by cubesat-fault-predictor/feature_schema.py - do not edit,\n")
+        f.write("// rerun it after changing the schema or retraining\n")
+        f.write("#ifndef __FEATURE_SCHEMA_H\n#define __FEATURE_SCHEMA_H\n\n")
+        f.write(f"#define FEATURE_SAMPLE_PERIOD_MS {SAMPLE_PERIOD_MS}\n\n")
+        f.write("// X(channel, window in samples, reference level, resolution)\n")
+        f.write("#define FEATURE_SCHEMA_CHANNELS(X) \\\n")
+        for name, window, level, resolution in CHANNELS:
+            f.write(f"    X({name.upper()}, {window}, {level:.7e}f, {resolution:.7e}f) \\\n")
+        f.write("\n")
+        f.write("// X(channel, statistic, training mean, training deviation), in network\n")
+        f.write("// input order. The classifier sees (input - mean) / deviation.\n")
+        f.write("#define FEATURE_SCHEMA_MODEL_INPUTS(X) \\\n")
+        for (channel, name), mean, scale in zip(MODEL_INPUTS, scaler.mean_, scaler.scale_):
+            f.write(f"    X({channel.upper()}, {name.upper()}, {F32(mean):.8e}f, {F32(scale):.8e}f) \\\n")
+        f.write("\n#endif\n")
+    print(f"Feature schema saved to {path}: {len(CHANNELS)} channels, "
+          f"{sum(w for _, w, _, _ in CHANNELS)} samples of window, {len(MODEL_INPUTS)} model inputs")
+
+def compare(path, df):
+    '''
+    Every statistic of every channel after every row, against the hex
+    floats tools/feature_engine_bench.c printed for the same rows.
+    '''
+    engine = FeatureEngine()
+    mismatches = 0
+
+    with open(path) as f:
+        lines = [line.split() for line in f if line.strip() and not line.startswith('#')]
+    if len(lines) != len(df):
+        sys.exit(f"{path} has {len(lines)} rows, the dataset {len(df)}")
+
+    for row, (sample, words) in enumerate(zip(df[FEATURES].values, lines)):
+        engine.push(sample)
+        expected = [engine.stat(channel, name) for channel in FEATURES for name in STATS]
+        for i, (value, word) in enumerate(zip(expected, words)):
+            firmware = struct.unpack("<f", bytes.fromhex(word))[0]
+            if struct.pack("<f", value) != struct.pack("<f", firmware):
+                if mismatches < 10:
+                    print(f"row {row}: {FEATURES[i // len(STATS)]}.{STATS[i % len(STATS)]} "
+                          f"{value!r} here, {firmware!r} in the firmware")
+                mismatches += 1
+
+    print(f"{len(df)} rows x {len(FEATURES) * len(STATS)} features: {mismatches} mismatches")
+    return mismatches == 0
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--compare", metavar="FILE",
+                        help="output of tools/feature_engine_bench.c on the dataset")
+    args = parser.parse_args()
+
+    import pandas as pd
+    df = pd.read_csv(DATA_FILE_PATH)
+    if args.compare:
+        if not compare(args.compare, df):
+            sys.exit(1)
+    else:
+        write_header(fit_scaler(df))
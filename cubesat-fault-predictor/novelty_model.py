@@ -0,0 +1,155 @@
+'''
+This script trains an unsupervised isolation forest on normal CubeSat
+operation, so that faults the labelled classifier has never seen still
+stand out as novel.
+
+The forest is exported twice:
+- as ONNX-ML (models/novelty_model.onnx) for X-CUBE-AI, when skl2onnx is
+  installed
+- as flat node tables for the firmware's own evaluator
+  (firmware/core/Src/app/novelty_model_data.c), checked against
+  scikit-learn's scores before they are written
+
+train_model.py calls it after the classifier; it also runs on its own.
+'''
+import numpy as np
+import pandas as pd
+from sklearn.ensemble import IsolationForest
+from sklearn.ensemble._iforest import _average_path_length
+import os
+from feature_schema import feature_matrix
+
+# Configuration
+DATA_FILE_PATH = "data/cubesat_data.csv"
+MODELS_DIR = "models"
+ONNX_MODEL_PATH = os.path.join(MODELS_DIR, "novelty_model.onnx")
+FIRMWARE_DATA_PATH = os.path.join("..", "firmware", "core", "Src", "app", "novelty_model_data.c")
+
+# Small enough to walk on every sample on the MCU: 16 trees of at most
+# 255 nodes, 8 bytes per node
+NOVELTY_TREES = 16
+NOVELTY_MAX_SAMPLES = 128
+# Share of normal operation allowed to score as novel
+NOVELTY_CONTAMINATION = 0.005
+# Firmware evaluator against scikit-learn, on the score
+SCORE_TOLERANCE = 1e-5
+
+# Ensure output directory exists
+os.makedirs(MODELS_DIR, exist_ok=True)
+
+def train_novelty_model(X_normal):
+    forest = IsolationForest(n_estimators=NOVELTY_TREES, max_samples=NOVELTY_MAX_SAMPLES,
+                             contamination=NOVELTY_CONTAMINATION, random_state=42)
+    forest.fit(X_normal.astype(np.float32))
+    return forest
+
+def flatten_forest(forest):
+    '''
+    Every tree in preorder, so a left child always directly follows its
+    parent and only the right child index is stored. Leaves carry their
+    path length: depth plus the expected depth of the samples left in them.
+    Nodes are [value, right, feature], feature -1 for a leaf.
+    '''
+    nodes = []
+    roots = []
+
+    def walk(tree, node, depth):
+        index = len(nodes)
+        if tree.children_left[node] == -1:
+            length = depth + _average_path_length([tree.n_node_samples[node]])[0]
+            nodes.append([float(np.float32(length)), 0, -1])
+            return
+        nodes.append([float(np.float32(tree.threshold[node])), 0, int(tree.feature[node])])
+        walk(tree, tree.children_left[node], depth + 1)
+        nodes[index][1] = len(nodes)
+        walk(tree, tree.children_right[node], depth + 1)
+
+    for estimator in forest.estimators_:
+        roots.append(len(nodes))
+        walk(estimator.tree_, 0, 0)
+
+    return nodes, roots
+
+def path_lengths(nodes, roots, X):
+    '''Sum of leaf path lengths over the trees, as the firmware walks them.'''
+    X = X.astype(np.float32)
+    totals = np.zeros(len(X), dtype=np.float32)
+
+    for row, x in enumerate(X):
+        total = np.float32(0.0)
+        for root in roots:
+            i = root
+            while nodes[i][2] >= 0:
+                i = i + 1 if x[nodes[i][2]] <= np.float32(nodes[i][0]) else nodes[i][1]
+            total += np.float32(nodes[i][0])
+        totals[row] = total
+
+    return totals
+
+def export_firmware_tables(forest, X_check, path=FIRMWARE_DATA_PATH):
+    nodes, roots = flatten_forest(forest)
+    if len(nodes) > 0xFFFF:
+        raise ValueError(f"{len(nodes)} nodes do not fit 16-bit child indices")
+
+    # score = 2^(-total * norm); novel above -offset_, i.e. below a total
+    norm = 1.0 / (len(roots) * _average_path_length([forest._max_samples])[0])
+    threshold = -np.log2(-forest.offset_) / norm
+
+    scores = 2.0 ** (-path_lengths(nodes, roots, X_check).astype(np.float64) * norm)
+    error = np.max(np.abs(scores + forest.score_samples(X_check.astype(np.float32))))
+    if error > SCORE_TOLERANCE:
+        raise ValueError(f"flattened forest is {error:.3g} from scikit-learn's score")
+
+    with open(path, 'w') as f:
+        f.write("// Generated by cubesat-fault-predictor/novelty_model.py - do not edit,\n")
+        f.write("// rerun it after retraining\n")
+        f.write("#include \"novelty_model.h\"\n\n")
+        f.write(f"const uint16_t novelty_model_tree_count = {len(roots)};\n")
+        f.write(f"const uint16_t novelty_model_node_count = {len(nodes)};\n")
+        f.write(f"const float novelty_model_path_norm = {norm:.9e}f;\n")
+        f.write(f"const float novelty_model_path_threshold = {threshold:.9e}f;\n\n")
+        f.write(f"const uint16_t novelty_model_roots[{len(roots)}] = {{\n")
+        for start in range(0, len(roots), 8):
+            f.write("    " + " ".join(f"{r}," for r in roots[start:start + 8]) + "\n")
+        f.write("};\n\n")
+        f.write(f"const novelty_node_t novelty_model_nodes[{len(nodes)}] = {{\n")
+        for value, right, feature in nodes:
+            f.write(f"    {{{value:.9e}f, {right}, {feature}, 0}},\n")
+        f.write("};\n")
+
+    print(f"Novelty tables saved to {path}: {len(roots)} trees, {len(nodes)} nodes, "
+          f"{len(nodes) * 8 + len(roots) * 2} bytes of flash (max score error {error:.2g})")
+
+def export_onnx(forest, n_features, path=ONNX_MODEL_PATH):
+    try:
+        from skl2onnx import to_onnx
+    except ImportError:
+        print("skl2onnx not installed, skipping the ONNX-ML export")
+        return
+
+    onnx_model = to_onnx(forest, np.zeros((1, n_features), dtype=np.float32),
+                         target_opset={'': 15, 'ai.onnx.ml': 3})
+    with open(path, 'wb') as f:
+        f.write(onnx_model.SerializeToString())
+    print(f"Novelty model saved to {path} ({os.path.getsize(path) / 1024:.2f} KB)")
+
+def train_and_export(X_train, y_train, X_test, y_test):
+    '''Fit on normal operation only; report how the known faults score.'''
+    forest = train_novelty_model(X_train[y_train == 0])
+
+    novel = forest.predict(X_test.astype(np.float32)) == -1
+    print(f"Novel: {np.mean(novel[y_test == 0]):.2%} of normal test samples, "
+          f"{np.mean(novel[y_test != 0]):.2%} of known faults")
+
+    export_firmware_tables(forest, X_test)
+    export_onnx(forest, X_train.shape[1])
+    return forest
+
+if __name__ == "__main__":
+    from sklearn.model_selection import train_test_split
+
+    df = pd.read_csv(DATA_FILE_PATH)
+    X = feature_matrix(df)
+    y = df['fault'].values
+    X_train, X_test, y_train, y_test = train_test_split(X, y, test_size=0.2, random_state=42, stratify=y)
+    train_and_export(X_train, y_train, X_test, y_test)
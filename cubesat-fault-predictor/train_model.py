@@ -10,6 +10,7 @@ from sklearn.model_selection import train_test_split
 from sklearn.preprocessing import StandardScaler
 import matplotlib.pyplot as plt
 import os
+from feature_schema import feature_matrix, write_header
 
 # Configuration
 DATA_FILE_PATH = "data/cubesat_data.csv"
@@ -18,6 +19,9 @@ IMAGES_DIR = "images"
 TFLITE_MODEL_PATH = os.path.join(MODELS_DIR, "fault_model.tflite")
 HISTORY_PLOT_PATH = os.path.join(IMAGES_DIR, "training_history.png")
 
+# The firmware acts on a fault above this softmax confidence
+DECISION_CONFIDENCE = 0.7
+
 # Ensure output directories exist
 os.makedirs(MODELS_DIR, exist_ok=True)
 os.makedirs(IMAGES_DIR, exist_ok=True)
@@ -45,6 +49,39 @@ def plot_history(history):
     plt.savefig(HISTORY_PLOT_PATH)
     print(f"\nTraining history plot saved to {HISTORY_PLOT_PATH}")
 
+def logit_margins(model, X):
+    """Top-1 softmax confidence and top-1 minus top-2 logit margin per sample."""
+    hidden = tf.keras.Model(model.inputs, model.layers[-2].output)(X).numpy()
+    weights, bias = model.layers[-1].get_weights()
+    logits = hidden @ weights + bias
+
+    ordered = np.sort(logits, axis=1)
+    margin = ordered[:, -1] - ordered[:, -2]
+    confidence = 1.0 / np.sum(np.exp(logits - ordered[:, -1:]), axis=1)
+    return confidence, margin
+
+def report_decision_band(model, X_check):
+    """
+    How often the firmware's skip-softmax decision path (ML_SKIP_SOFTMAX)
+    still needs the softmax. Its band is the one ml_integration.h proves
+    for any model: below ln(odds) even a lone runner-up keeps the top class
+    under the threshold, above ln((n-1) odds) even n-1 runners-up cannot
+    pull it below, so the decisions equal confidence > DECISION_CONFIDENCE
+    on every input. Nothing here is written to the firmware.
+    """
+    classes = model.layers[-1].units
+    odds = DECISION_CONFIDENCE / (1.0 - DECISION_CONFIDENCE)
+    low = np.log(odds)
+    high = np.log((classes - 1) * odds)
+
+    confidence, margin = logit_margins(model, X_check)
+    in_band = (margin >= low) & (margin <= high)
+    decided = margin > high
+    agree = np.mean(in_band | (decided == (confidence > DECISION_CONFIDENCE)))
+    print(f"Decision margin band: [{low:.7f}, {high:.7f}]")
+    print(f"  softmax needed for {np.mean(in_band):.1%} of held-out samples, "
+          f"agreement with confidence > {DECISION_CONFIDENCE}: {agree:.2%}")
+
 def train_and_convert():
     # 1. Load and preprocess data
     print(f"Loading data from {DATA_FILE_PATH}...")
@@ -54,22 +91,25 @@ def train_and_convert():
         print(f"Error: Data file not found. Please run generate_data.py first.")
         return
 
-    features = [
-        'bus_voltage', 'current_draw', 'power_consumption', 'mcu_core_temp', 'heartbeat_signal',
-        'uart_packets_received', 'crc_error_count', 'uart_timeout'
-    ]
     target = 'fault'
 
-    X = df[features].values
+    # Network inputs as the firmware's feature engine computes them
+    X = feature_matrix(df)
     y = df[target].values
 
     X_train, X_test, y_train, y_test = train_test_split(X, y, test_size=0.2, random_state=42, stratify=y)
 
+    # The novelty forest works on raw units
+    X_train_raw, X_test_raw = X_train, X_test
+
     # Scale the features
     scaler = StandardScaler()
     X_train = scaler.fit_transform(X_train)
     X_test = scaler.transform(X_test)
 
+    # The firmware standardises the classifier's input with the same scaler
+    write_header(scaler)
+
     # 2. Build the Keras model
     print("Building the neural network model...")
     model = tf.keras.Sequential([
@@ -98,13 +138,17 @@ def train_and_convert():
     loss, accuracy = model.evaluate(X_test, y_test, verbose=0)
     print(f"Keras model accuracy: {accuracy:.4f}")
 
-    # 6. Convert to TensorFlow Lite model
+    # 6. Softmax work left by the skip-softmax decision band
+    print("\nChecking the logit margin band...")
+    report_decision_band(model, X_test)
+
+    # 7. Convert to TensorFlow Lite model
     print(f"\nConverting to TensorFlow Lite model...")
     converter = tf.lite.TFLiteConverter.from_keras_model(model)
     converter.optimizations = [tf.lite.Optimize.DEFAULT]
     tflite_model = converter.convert()
 
-    # 7. Save the .tflite model
+    # 8. Save the .tflite model
     with open(TFLITE_MODEL_PATH, 'wb') as f:
         f.write(tflite_model)
 
@@ -115,5 +159,10 @@ def train_and_convert():
     if model_size > 50 * 1024:
         print("Warning: Model size exceeds the 50 KB target.")
 
+    # 9. Train the novelty model for faults the classifier has no label for
+    print("\nTraining the novelty model...")
+    from novelty_model import train_and_export
+    train_and_export(X_train_raw, y_train, X_test_raw, y_test)
+
 if __name__ == "__main__":
     train_and_convert()
\ No newline at end of file
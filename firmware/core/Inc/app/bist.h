@@ -0,0 +1,69 @@
+#ifndef __BIST_H
+#define __BIST_H
+
+#include "main.h"
+
+// Golden vector tolerance per softmax output (float kernels, same order of
+// operations as the host reference in tools/golden_vector.py)
+#define BIST_GOLDEN_TOLERANCE 1e-4f
+#define BIST_GOLDEN_INPUT_SIZE 8
+#define BIST_GOLDEN_OUTPUT_SIZE 5
+
+// Accepted analog supply from VREFINT, mV
+#define BIST_VDDA_MIN_MV 3000
+#define BIST_VDDA_MAX_MV 3600
+
+typedef enum {
+    BIST_TEST_FLASH_CRC = 0,    // Image CRC-32 against the value patched in after linking
+    BIST_TEST_RAM_CRC,          // ITCM code copy against its flash load image
+    BIST_TEST_ADC_VREF,         // VDDA from VREFINT and its factory calibration
+    BIST_TEST_UART_LOOPBACK,    // USART1 half-duplex internal loopback
+    BIST_TEST_I2C_PROBE,        // I2C1 bus free and address scan without bus errors
+    BIST_TEST_GOLDEN_INFERENCE, // Fixed input through the live network
+    BIST_TEST_WATCHDOG_LINE,    // TPL5010 WAKE read back, DONE not asserted
+    BIST_TEST_COUNT
+} bist_test_t;
+
+#define BIST_ALL_TESTS ((uint8_t)((1U << BIST_TEST_COUNT) - 1))
+
+typedef enum {
+    BIST_NOT_RUN = 0,
+    BIST_PASS,
+    BIST_FAIL,
+    BIST_SKIPPED                // Precondition missing, e.g. no image CRC patched in
+} bist_status_t;
+
+typedef enum {
+    BIST_TRIGGER_BOOT = 0,
+    BIST_TRIGGER_COMMAND        // TTC_CMD_RUN_BIST uplink
+} bist_trigger_t;
+
+typedef struct {
+    bist_status_t status;
+    uint32_t detail;            // Test specific measurement, see bist.c
+    uint32_t duration_us;
+} bist_result_t;
+
+typedef struct {
+    bist_result_t tests[BIST_TEST_COUNT];
+    bist_trigger_t trigger;
+    uint32_t run_count;
+    uint32_t total_us;
+    uint32_t finished_tick;
+} bist_report_t;
+
+// Telemetry layout: [trigger][passed mask][failed mask][skipped mask],
+// u32 LE run count and total us, then per test [status] u32 LE detail
+// and duration us
+#define BIST_REPORT_HEADER_SIZE (4 + 2 * 4)
+#define BIST_REPORT_ENTRY_SIZE (1 + 2 * 4)
+#define BIST_REPORT_SIZE (BIST_REPORT_HEADER_SIZE + BIST_TEST_COUNT * BIST_REPORT_ENTRY_SIZE)
+
+// Function prototypes
+uint8_t bist_run(bist_trigger_t trigger, uint8_t test_mask);
+void bist_get_report(bist_report_t *report);
+uint16_t bist_build_report(uint8_t *buffer, uint16_t size);
+void bist_golden_vector(const float **input, const float **output);
+float bist_golden_error(const float *output, const float *expected);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef __BLACKBOX_H
+#define __BLACKBOX_H
+
+#include "main.h"
+#include "ml_integration.h"
+
+// Pre-trigger history: one record per inference cycle (10Hz)
+#define BLACKBOX_SAMPLE_PERIOD_MS 100
+#define BLACKBOX_HISTORY_S 10
+#define BLACKBOX_DEPTH ((BLACKBOX_HISTORY_S * 1000) / BLACKBOX_SAMPLE_PERIOD_MS)
+
+// Only the features the model actually consumes are kept, in raw units
+#define BLACKBOX_FEATURE_COUNT 8
+
+typedef struct {
+    uint32_t timestamp;
+    float features[BLACKBOX_FEATURE_COUNT];
+    float outputs[ML_OUTPUT_SIZE];     // Logits with ML_SKIP_SOFTMAX, probabilities once downlinked
+    uint8_t predicted_class;
+    uint8_t system_state;
+    uint8_t origin;                 // ml_output_origin_t: with ML_OUTPUT_GATED, outputs are a stand-in
+    uint8_t reserved;
+} blackbox_record_t;
+
+typedef struct {
+    blackbox_record_t records[BLACKBOX_DEPTH];
+    uint16_t head;      // Next slot to write
+    uint16_t count;     // Valid records (saturates at BLACKBOX_DEPTH)
+} blackbox_ring_t;
+
+typedef struct {
+    ml_result_t trigger;        // Fault that froze the recorder, class 0 for a HardFault
+    uint32_t freeze_time;
+    uint16_t record_count;
+    uint16_t dropped_triggers;  // Faults seen while a capture was still held
+    uint8_t previous_boot;      // Held across a reset; times are the previous run's ticks
+} blackbox_capture_info_t;
+
+// A held capture is copied to retained RAM next to crash_context, so a
+// reset before it has been downlinked (escalation, HardFault) does not
+// lose it; the next boot downlinks it instead
+#define BLACKBOX_RETAINED_MAGIC 0xB1ACB0C5UL
+
+// Function prototypes
+void blackbox_init(void);
+void blackbox_record(const float *features, const float *outputs, const ml_result_t *result,
+                     ml_output_origin_t origin);
+uint8_t blackbox_freeze(const ml_result_t *trigger);
+uint8_t blackbox_has_capture(void);
+uint8_t blackbox_get_capture_record(uint16_t index, blackbox_record_t *record);
+void blackbox_get_capture_info(blackbox_capture_info_t *info);
+void blackbox_release_capture(void);
+void blackbox_retain_on_crash(void);
+void blackbox_service_downlink(void);
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef __BOOT_TIMELINE_H
+#define __BOOT_TIMELINE_H
+
+#include "main.h"
+
+// Reset to first classified sample. Time before main() (startup copy and
+// SystemInit) is not seen by the DWT and is not included.
+#define BOOT_DETECTION_BUDGET_US 100000
+
+// Startup as a dependency graph. Steps up to SUBSYSTEMS run in main();
+// the rest run concurrently in the tasks that own them and wait only for
+// their own dependencies.
+typedef enum {
+    BOOT_STEP_MAIN = 0,         // DWT started, t = 0
+    BOOT_STEP_CLOCKS,           // SystemClock_Config
+    BOOT_STEP_PERIPHERALS,      // CubeMX peripheral and X-CUBE-AI init
+    BOOT_STEP_SUBSYSTEMS,       // Application subsystems, boot LEDs posted
+    BOOT_STEP_SCHEDULER,        // First task running
+    BOOT_STEP_ML_MODEL,         // Network created by ml_inference_task
+    BOOT_STEP_DETECTION,        // First sample classified
+    BOOT_STEP_LOW_POWER,        // LSE started, LPTIM1 calibrated (boot_task)
+    BOOT_STEP_SELF_TEST,        // Self test finished (boot_task)
+    BOOT_STEP_COUNT
+} boot_step_t;
+
+#define BOOT_STEP_BIT(step) (1U << (step))
+
+typedef struct {
+    uint32_t step_us[BOOT_STEP_COUNT];  // Completion time since main()
+    uint16_t done;                      // BOOT_STEP_BIT of finished steps
+    uint16_t failed;                    // Finished, but did not succeed
+} boot_timeline_t;
+
+// Telemetry layout: [done u16][failed u16][detection within budget] then
+// u32 LE completion us for every boot_step_t
+#define BOOT_TIMELINE_REPORT_SIZE (5 + BOOT_STEP_COUNT * 4)
+
+// Function prototypes
+void boot_timeline_init(void);
+void boot_timeline_start(void);
+void boot_timeline_mark(boot_step_t step);
+void boot_timeline_fail(boot_step_t step);
+uint8_t boot_timeline_wait(boot_step_t step, uint32_t timeout);
+uint8_t boot_timeline_ok(boot_step_t step);
+void boot_timeline_get(boot_timeline_t *timeline);
+uint16_t boot_timeline_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
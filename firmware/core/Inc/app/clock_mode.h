@@ -0,0 +1,59 @@
+#ifndef __CLOCK_MODE_H
+#define __CLOCK_MODE_H
+
+#include "main.h"
+
+// Performance is held this long after the last request before dropping
+// back to the monitoring profile
+#define CLOCK_MODE_HOLD_MS 10000
+
+typedef enum {
+    CLOCK_MODE_MONITOR = 0,     // VOS3, CPU 68.75 MHz - routine 10 Hz monitoring
+    CLOCK_MODE_PERFORMANCE,     // VOS0, CPU 275 MHz - anomaly analysis and recovery
+    CLOCK_MODE_COUNT
+} clock_mode_t;
+
+// Why the performance profile is wanted (bitmap in the stats)
+typedef enum {
+    CLOCK_REASON_BOOT = 0,
+    CLOCK_REASON_ML_ANOMALY,
+    CLOCK_REASON_HEARTBEAT,
+    CLOCK_REASON_RECOVERY,
+    CLOCK_REASON_COUNT
+} clock_reason_t;
+
+// One clock profile. PLL1 is never touched: only the D1CPRE divider and
+// the core voltage change, so a switch does not wait for a PLL lock.
+typedef struct {
+    uint32_t voltage_scale;     // PWR_REGULATOR_VOLTAGE_SCALEx
+    RCC_ClkInitTypeDef clocks;  // SYSCLK stays on PLL1 in every profile
+    uint32_t flash_latency;
+    uint32_t i2c1_timing;       // 100 kHz at this profile's PCLK1
+} clock_profile_t;
+
+typedef struct {
+    clock_mode_t mode;
+    uint8_t reasons;                // Active clock_reason_t bits
+    uint32_t switches[CLOCK_MODE_COUNT];    // Switches into each mode
+    uint32_t deferred;              // Switches postponed, I2C was busy
+    uint32_t ticks_in_mode[CLOCK_MODE_COUNT];
+    uint32_t last_switch_cycles;
+    uint32_t last_switch_us;
+    uint32_t worst_switch_us;
+} clock_mode_stats_t;
+
+// Telemetry layout: [mode][reasons] then u32 LE fields: switches to
+// monitor/performance, deferred, ticks in monitor/performance, last and
+// worst switch us
+#define CLOCK_MODE_REPORT_SIZE (2 + 7 * 4)
+
+// Function prototypes
+void clock_mode_init(void);
+void clock_mode_request(clock_reason_t reason);
+void clock_mode_service(void);
+clock_mode_t clock_mode_get(void);
+uint32_t clock_mode_timer_clock_hz(void);
+void clock_mode_get_stats(clock_mode_stats_t *stats);
+uint16_t clock_mode_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef __CRASH_CONTEXT_H
+#define __CRASH_CONTEXT_H
+
+#include "main.h"
+
+#define CRASH_CONTEXT_MAGIC 0xC0DEFA17UL
+
+// Why the previous run ended, as recorded by software before it went down.
+// A reset with CRASH_REASON_NONE was not anticipated (external watchdog,
+// brown-out, power cycle), RCC_RSR tells which.
+typedef enum {
+    CRASH_REASON_NONE = 0,
+    CRASH_REASON_RESET_REQUEST,     // reset_control_task pulsed RESET_OUT
+    CRASH_REASON_ERROR_HANDLER,     // Error_Handler() was entered
+    CRASH_REASON_HARDFAULT,         // HardFault with stacked registers captured
+    CRASH_REASON_WATCHDOG_STARVED   // TPL5010 deliberately left un-kicked
+} crash_reason_t;
+
+// Registers pushed by the core on exception entry, plus fault status
+typedef struct {
+    uint32_t r0;
+    uint32_t r1;
+    uint32_t r2;
+    uint32_t r3;
+    uint32_t r12;
+    uint32_t lr;
+    uint32_t pc;
+    uint32_t xpsr;
+    uint32_t cfsr;
+    uint32_t hfsr;
+    uint32_t mmfar;
+    uint32_t bfar;
+} crash_fault_frame_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t boot_count;
+    uint32_t reset_flags;           // RCC_RSR captured at the start of this boot
+    uint32_t reason_data;           // Reset source bitmap or Error_Handler caller
+    uint32_t last_fault_time;
+    uint32_t last_checkpoint_time;
+    uint8_t reason;                 // crash_reason_t
+    uint8_t last_system_state;
+    uint8_t last_fault_class;
+    uint8_t valid_on_boot;          // Retained copy passed magic+CRC this boot
+    crash_fault_frame_t fault_frame;
+    uint32_t crc;                   // CRC-32 over everything above
+} crash_context_t;
+
+// Function prototypes
+void crash_context_init(void);
+const crash_context_t* crash_context_get_boot_report(void);
+void crash_context_note_fault(const ml_result_t *fault);
+void crash_context_note_reset(crash_reason_t reason, uint32_t reason_data);
+void crash_context_checkpoint(void);
+void crash_context_capture_hardfault(uint32_t *stack_frame);
+
+#endif
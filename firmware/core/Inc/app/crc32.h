@@ -0,0 +1,13 @@
+#ifndef __CRC32_H
+#define __CRC32_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// CRC-32 (IEEE 802.3, reflected, poly 0xEDB88320) - same as zlib.crc32
+#define CRC32_INIT 0xFFFFFFFFUL
+
+uint32_t crc32_update(uint32_t crc, const void *data, size_t length);
+uint32_t crc32_compute(const void *data, size_t length);
+
+#endif
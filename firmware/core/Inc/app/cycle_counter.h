@@ -0,0 +1,18 @@
+#ifndef __CYCLE_COUNTER_H
+#define __CYCLE_COUNTER_H
+
+#include "main.h"
+
+// DWT cycle counter: 32-bit, wraps every ~15.6 s at 275 MHz (~62 s in the
+// 68.75 MHz monitoring mode). Differences of two readings are valid across
+// one wrap thanks to unsigned arithmetic, so nothing timed with it may run
+// longer than ~15 s.
+#define CYCLES_TO_US(cycles) ((uint32_t)((cycles) / (SystemCoreClock / 1000000U)))
+
+void cycle_counter_init(void);
+
+static inline uint32_t cycle_counter_now(void) {
+    return DWT->CYCCNT;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef __FAST_RULES_H
+#define __FAST_RULES_H
+
+#include "main.h"
+#include "heartbeat_monitor.h"
+#include "ttc_communication.h"
+
+// Hard limits checked where the signal arrives instead of in the 100 ms
+// inference loop. Each of these fault classes is separated by one feature
+// in cubesat-fault-predictor/generate_data.py (fast_rules.py checks the
+// thresholds against the dataset), so the network is left with what
+// takes several features to decide.
+typedef enum {
+    FAST_RULE_HEARTBEAT_LOST = 0,   // Class 1: no PC13 edge, LPTIM2 deadline
+    FAST_RULE_UART_TIMEOUT,         // Class 3: repeated USART1 receiver timeouts
+    FAST_RULE_CORRUPTION,           // Class 4: burst of line and frame CRC errors
+    FAST_RULE_COUNT
+} fast_rule_t;
+
+#define FAST_RULE_BIT(rule) (1U << (rule))
+
+#define FAST_RULE_HEARTBEAT_TIMEOUT_MS HEARTBEAT_TIMEOUT_MS
+#define FAST_RULE_UART_TIMEOUT_MS TTC_TIMEOUT_MS
+// One receiver timeout is just the end of an uplink burst, so the rule
+// needs this many within the window: a link that keeps dropping mid-pass.
+// A link that stays silent is left to the polled ttc_check_connection.
+#define FAST_RULE_UART_TIMEOUTS 3
+#define FAST_RULE_UART_TIMEOUT_WINDOW_MS 30000
+#define FAST_RULE_CORRUPTION_ERRORS 5       // crc_error_count >= 5 in the dataset
+#define FAST_RULE_CORRUPTION_WINDOW_MS 1000
+
+// After a rule fires, the same class from the network or a polled check
+// is dropped for this long. A lost heartbeat re-fires every timeout, so
+// the polled heartbeat check never doubles it.
+#define FAST_RULES_HOLD_MS 5000
+
+// Fault classes 1-4, index class - 1
+#define FAST_RULES_CLASSES (ML_OUTPUT_SIZE - 1)
+
+typedef struct {
+    uint32_t rule_fires;
+    uint32_t rule_last_us;          // Interrupt -> fault handler
+    uint32_t rule_worst_us;
+    uint32_t network_detections;    // Including those a rule had already raised
+    uint32_t network_last_us;       // Sample taken -> decision
+    uint32_t network_worst_us;
+} fast_rules_class_stats_t;
+
+typedef struct {
+    fast_rules_class_stats_t fault_class[FAST_RULES_CLASSES];
+    uint32_t network_dropped;       // Network faults a rule had already raised
+    uint32_t corruption_errors;     // Line and uplink CRC errors counted
+    uint32_t uart_timeouts;         // Receiver timeouts, fired or not
+} fast_rules_stats_t;
+
+// Telemetry layout: [armed rule bits][0][0][0], u32 LE network dropped,
+// corruption errors and receiver timeouts, then per fault class 1-4 the six fast_rules_class_stats_t
+// fields. The network figures leave out the wait for the next inference
+// period, up to 100 ms, that the rules do not have.
+#define FAST_RULES_REPORT_SIZE (4 + 3 * 4 + FAST_RULES_CLASSES * 6 * 4)
+
+// Function prototypes
+void fast_rules_init(void);
+void fast_rules_heartbeat_edge_from_isr(void);
+void fast_rules_lptim_irq(void);
+void fast_rules_uart_error_from_isr(uint32_t error_code);
+void fast_rules_crc_error(void);
+uint8_t fast_rules_claimed(uint8_t fault_class);
+uint8_t fast_rules_note_network(const ml_result_t *result, uint32_t sample_cycles);
+void fast_rules_note_handled(const ml_result_t *fault);
+void fast_rules_get_stats(fast_rules_stats_t *stats);
+uint16_t fast_rules_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
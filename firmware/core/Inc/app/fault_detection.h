@@ -3,6 +3,7 @@
 
 #include "main.h"
 #include "cmsis_os.h"
+#include "ml_integration.h"
 
 // Heartbeat monitor defines
 #define HEARTBEAT_IN_PIN GPIO_PIN_13    // PC13
@@ -19,17 +20,14 @@
 // Function prototypes
 void heartbeat_monitor_task(void *argument);
 void ml_inference_task(void *argument);
+ml_model_t *ml_inference_model(void);
 void fault_handler_task(void *argument);
 void handle_detected_fault(ml_result_t* fault_result);
-void restart_uart_link(void);
-void request_data_retransmission(void);
 
 // Sensor function prototypes
 float read_cpu_temperature(void);
 float read_voltage_3v3(void);
 float read_voltage_5v(void);
-float get_cpu_usage_percent(void);
-float get_memory_usage_percent(void);
 float get_heartbeat_rate(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef __FAULT_MODEL_KERNEL_H
+#define __FAULT_MODEL_KERNEL_H
+
+#include <stdint.h>
+
+// Run the network through the fused kernel instead of the X-CUBE-AI
+// runtime. Both are always built so perf_bench can compare them; build
+// with -DML_FUSED_KERNEL=1 to make the kernel the one inference uses.
+#ifndef ML_FUSED_KERNEL
+#define ML_FUSED_KERNEL 0
+#endif
+
+// fault_model topology: 8 -> dense 16 relu -> dense 8 relu -> dense 5 softmax
+#define FAULT_MODEL_INPUTS 8
+#define FAULT_MODEL_HIDDEN1 16
+#define FAULT_MODEL_HIDDEN2 8
+#define FAULT_MODEL_OUTPUTS 5
+
+// Byte offsets in the X-CUBE-AI weights blob, from
+// ai_network_configure_weights in network.c
+#define FAULT_MODEL_HIDDEN1_WEIGHTS_AT 0
+#define FAULT_MODEL_HIDDEN1_BIAS_AT 512
+#define FAULT_MODEL_HIDDEN2_WEIGHTS_AT 576
+#define FAULT_MODEL_HIDDEN2_BIAS_AT 1088
+#define FAULT_MODEL_OUTPUT_WEIGHTS_AT 1120
+#define FAULT_MODEL_OUTPUT_BIAS_AT 1280
+#define FAULT_MODEL_WEIGHTS_SIZE 1300
+
+// Generated by tools/fault_model_kernel.py, [output][input] row major.
+// Writable so fault_model_kernel_load can swap in uploaded weights.
+extern float fault_model_hidden1_weights[FAULT_MODEL_HIDDEN1 * FAULT_MODEL_INPUTS];
+extern float fault_model_hidden1_bias[FAULT_MODEL_HIDDEN1];
+extern float fault_model_hidden2_weights[FAULT_MODEL_HIDDEN2 * FAULT_MODEL_HIDDEN1];
+extern float fault_model_hidden2_bias[FAULT_MODEL_HIDDEN2];
+extern float fault_model_output_weights[FAULT_MODEL_OUTPUTS * FAULT_MODEL_HIDDEN2];
+extern float fault_model_output_bias[FAULT_MODEL_OUTPUTS];
+
+// Function prototypes
+void fault_model_kernel_load(const uint8_t *weights);
+void fault_model_kernel_run(const float *input, float *output);
+void fault_model_kernel_logits(const float *input, float *logits);
+void fault_model_kernel_features(const float *input, float *hidden2);
+void fault_model_softmax(float *values);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef __FEATURE_ENGINE_H
+#define __FEATURE_ENGINE_H
+
+#include <stdint.h>
+#include "feature_schema.h"
+
+// Sliding-window statistics per sensor channel, one sample per inference
+// period, O(1) work per sample and a fixed arena. Channels, windows and
+// the network's inputs come from feature_schema.h, generated by
+// cubesat-fault-predictor/feature_schema.py, which also computes the
+// same statistics for training. Host builds need -ffp-contract=off too
+// for them to agree bit for bit.
+//
+// Model inputs come out in raw units, as the novelty forest, the cascade
+// gate and the inference cache use them; feature_engine_standardise turns
+// them into what the classifier was trained on.
+typedef enum {
+#define FEATURE_CHANNEL_ENUM(name, window, level, resolution) FEATURE_CHANNEL_##name,
+    FEATURE_SCHEMA_CHANNELS(FEATURE_CHANNEL_ENUM)
+#undef FEATURE_CHANNEL_ENUM
+    FEATURE_CHANNEL_COUNT
+} feature_channel_t;
+
+typedef enum {
+    FEATURE_STAT_VALUE = 0,         // Latest sample
+    FEATURE_STAT_MEAN,
+    FEATURE_STAT_VARIANCE,
+    FEATURE_STAT_SLOPE,             // Least-squares fit, per second
+    FEATURE_STAT_MIN,
+    FEATURE_STAT_MAX,
+    FEATURE_STAT_CROSSINGS,         // Neighbours on either side of the reference level
+    FEATURE_STAT_RATE,              // Newest minus oldest, per second
+    FEATURE_STAT_COUNT
+} feature_stat_t;
+
+#define FEATURE_WINDOW_SUM(name, window, level, resolution) + (window)
+#define FEATURE_INPUT_COUNT(channel, stat, mean, scale) + 1
+enum {
+    FEATURE_ARENA_SAMPLES = 0 FEATURE_SCHEMA_CHANNELS(FEATURE_WINDOW_SUM),
+    FEATURE_MODEL_INPUTS = 0 FEATURE_SCHEMA_MODEL_INPUTS(FEATURE_INPUT_COUNT)
+};
+#undef FEATURE_WINDOW_SUM
+#undef FEATURE_INPUT_COUNT
+
+// Samples, then the min and max queues as ring positions
+#define FEATURE_ARENA_BYTES (FEATURE_ARENA_SAMPLES * (sizeof(float) + 2))
+
+// Function prototypes
+void feature_engine_init(void);
+void feature_engine_push(const float *sample);
+float feature_engine_stat(feature_channel_t channel, feature_stat_t stat);
+void feature_engine_model_input(float *input, uint16_t size);
+void feature_engine_standardise(const float *features, float *input);
+
+#endif
@@ -0,0 +1,31 @@
+// Generated by cubesat-fault-predictor/feature_schema.py - do not edit,
+// rerun it after changing the schema or retraining
+#ifndef __FEATURE_SCHEMA_H
+#define __FEATURE_SCHEMA_H
+
+#define FEATURE_SAMPLE_PERIOD_MS 100
+
+// X(channel, window in samples, reference level, resolution)
+#define FEATURE_SCHEMA_CHANNELS(X) \
+    X(BUS_VOLTAGE, 16, 5.0000000e+00f, 1.0000000e-02f) \
+    X(CURRENT_DRAW, 16, 5.0000000e-01f, 1.0000000e-03f) \
+    X(POWER_CONSUMPTION, 16, 2.5000000e+00f, 1.0000000e-02f) \
+    X(MCU_CORE_TEMP, 32, 3.5000000e+01f, 5.0000000e-01f) \
+    X(HEARTBEAT_SIGNAL, 8, 5.0000000e-01f, 1.0000000e+00f) \
+    X(UART_PACKETS_RECEIVED, 8, 5.0000000e+01f, 1.0000000e+00f) \
+    X(CRC_ERROR_COUNT, 8, 2.5000000e+00f, 1.0000000e+00f) \
+    X(UART_TIMEOUT, 8, 5.0000000e-01f, 1.0000000e+00f) \
+
+// X(channel, statistic, training mean, training deviation), in network
+// input order. The classifier sees (input - mean) / deviation.
+#define FEATURE_SCHEMA_MODEL_INPUTS(X) \
+    X(BUS_VOLTAGE, VALUE, 4.99297619e+00f, 4.16356921e-02f) \
+    X(CURRENT_DRAW, VALUE, 5.17706037e-01f, 9.56791490e-02f) \
+    X(POWER_CONSUMPTION, VALUE, 2.58272362e+00f, 4.59233522e-01f) \
+    X(MCU_CORE_TEMP, VALUE, 3.51666641e+01f, 8.60630512e+00f) \
+    X(HEARTBEAT_SIGNAL, VALUE, 9.49999988e-01f, 2.17944950e-01f) \
+    X(UART_PACKETS_RECEIVED, VALUE, 9.21457520e+01f, 2.11842518e+01f) \
+    X(CRC_ERROR_COUNT, VALUE, 1.08675003e+00f, 2.78544879e+00f) \
+    X(UART_TIMEOUT, VALUE, 5.00000007e-02f, 2.17944950e-01f) \
+
+#endif
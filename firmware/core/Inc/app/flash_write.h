@@ -0,0 +1,23 @@
+#ifndef __FLASH_WRITE_H
+#define __FLASH_WRITE_H
+
+#include "main.h"
+
+// Programming unit of the H7 flash: 256 bits, written once per erase
+#define FLASH_WRITE_WORD 32
+
+// Sectors written at run time, kept out of the image by the linker script
+#define FLASH_WRITE_ADAPTATION_SECTOR FLASH_SECTOR_4   // 0x08080000 and 0x080A0000, ml_adaptation log
+#define FLASH_WRITE_MODEL_SLOT_SECTOR FLASH_SECTOR_6   // 0x080C0000 and 0x080E0000, model_update
+
+#define FLASH_WRITE_SECTOR_ADDRESS(sector) (FLASH_BANK1_BASE + (uint32_t)(sector) * FLASH_SECTOR_SIZE)
+
+// The TPL5010 is kicked through a sector erase for at most this long; an
+// erase that has not finished by then is left to the watchdog
+#define FLASH_WRITE_ERASE_TIMEOUT_MS 4000
+
+// Function prototypes
+uint8_t flash_write_erase(uint32_t sector);
+uint8_t flash_write_word(uint32_t address, const uint8_t *data);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef __LED_ANIMATION_H
+#define __LED_ANIMATION_H
+
+#include "main.h"
+#include "ws2812b_driver.h"
+
+// Stepped from led_controller_task at 20 Hz
+#define LED_ANIMATION_STEP_MS 50
+#define LED_ANIMATION_MAX_KEYFRAMES 8
+
+typedef enum {
+    LED_EFFECT_SOLID = 0,
+    LED_EFFECT_BLINK,           // On for the first half of the period
+    LED_EFFECT_BREATHE,         // Raised sine over the period
+    LED_EFFECT_CHASE,           // One lit LED walking across the strip
+    LED_EFFECT_KEYFRAMES        // Colour track from the keyframe list
+} led_effect_t;
+
+typedef struct {
+    uint16_t at_ms;             // Offset into the period, ascending
+    ws2812b_color_t color;
+} led_keyframe_t;
+
+// One declarative animation. Tables of these live in flash; the engine
+// only keeps a pointer and a start time.
+typedef struct led_animation_s {
+    led_effect_t effect;
+    ws2812b_color_t color;      // Unused by LED_EFFECT_KEYFRAMES
+    uint16_t period_ms;
+    uint8_t repeats;            // Periods to play, 0 = forever
+    uint8_t led_phase;          // Per-LED phase offset, 256 = one period
+    uint8_t interpolate;        // Keyframes: blend (1) or step (0)
+    uint8_t keyframe_count;
+    const led_keyframe_t *keyframes;
+    const struct led_animation_s *next;     // Played when done, NULL holds the last frame
+} led_animation_t;
+
+extern const led_animation_t led_animation_boot;
+extern const led_animation_t led_animation_normal;
+
+// Function prototypes
+void led_animation_play(const led_animation_t *animation);
+void led_animation_step(uint32_t now_ms);
+
+// Former blocking patterns, now one-shot animations that return at once
+void ws2812b_chase_pattern(ws2812b_color_t color, uint16_t num_cycles);
+void ws2812b_breathe_pattern(ws2812b_color_t color, uint16_t duration_ms);
+
+#endif
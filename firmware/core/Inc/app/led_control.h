@@ -2,6 +2,7 @@
 #define __LED_CONTROL_H
 
 #include "main.h"
+#include "led_animation.h"
 
 typedef struct {
     GPIO_TypeDef* port;
@@ -13,18 +14,54 @@ typedef struct {
     char* name;
 } led_control_t;
 
+// Subsystems that drive indicators; each owns one compositor layer
+typedef enum {
+    LED_SOURCE_SYSTEM_STATE = 0,
+    LED_SOURCE_BOOT,
+    LED_SOURCE_ML,
+    LED_SOURCE_HEARTBEAT,
+    LED_SOURCE_RESET,
+    LED_SOURCE_COUNT
+} led_source_t;
+
+// Usual priorities: fault and reset indication override routine state
+#define LED_PRIORITY_STATE 10
+#define LED_PRIORITY_BOOT 20
+#define LED_PRIORITY_ML 30
+#define LED_PRIORITY_HEARTBEAT 40
+#define LED_PRIORITY_RESET 50
+
+#define LED_MASK(led) ((uint8_t)(1U << (led)))
+#define LED_MASK_ALL ((uint8_t)((1U << LED_COUNT) - 1))
+
+// What one subsystem wants shown. For every LED the highest-priority
+// live layer that drives it wins; blinking LEDs share one phase.
 typedef struct {
-    uint8_t red;
-    uint8_t green;
-    uint8_t blue;
-} rgb_color_t;
+    uint8_t priority;           // Higher wins, 0 is never shown
+    uint8_t drive_mask;         // LEDs this layer decides (LED_MASK bits)
+    uint8_t on_mask;            // Of those, steady on
+    uint8_t blink_mask;         // Of those, blinking at blink_ms
+    uint16_t blink_ms;
+    const led_animation_t *rgb; // Strip animation, NULL leaves it to lower layers
+} led_indication_t;
+
+// Boot chase and RGB test with SYS_OK blinking, posted by
+// system_startup_sequence; long enough for led_animation_boot to finish
+#define LED_BOOT_INDICATION_MS 3000
+extern const led_indication_t led_indication_boot;
+
+// Strip colours of the fault classes, for both the ML and state layers
+extern const led_animation_t rgb_obc_fault;
+extern const led_animation_t rgb_ttc_fault;
+
+// Compositor (rendered by led_controller_task)
+void led_compositor_post(led_source_t source, const led_indication_t *indication, uint32_t ttl_ms);
+void led_compositor_clear(led_source_t source);
+void led_compositor_render(uint32_t now);
 
+// Direct GPIO access, for self tests that run before the compositor
 void led_system_init(void);
 void set_led(led_id_t led_id, uint8_t state);
-void set_led_blink_rate(led_id_t led_id, uint32_t interval_ms);
-void update_leds_task(void);
 void update_leds_from_ml_result(ml_result_t* result);
-void ws2812b_set_color(rgb_color_t color);
-void ws2812b_chase_pattern(rgb_color_t color);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,54 @@
+#ifndef __LOW_POWER_H
+#define __LOW_POWER_H
+
+#include "main.h"
+
+// LPTIM1 runs from LSE (LSI if the crystal does not start) divided by 8,
+// i.e. ~4 kHz: 0.25 ms resolution and a 16 s free-running wrap
+#define LOW_POWER_LPTIM_PRESCALER_LOG2 3
+#define LOW_POWER_LSE_TIMEOUT_MS 2000
+#define LOW_POWER_CALIBRATION_COUNTS 40     // ~10 ms against the DWT at boot
+#define LOW_POWER_MAX_SLEEP_COUNTS 0xFF00U  // Margin below the 16-bit wrap
+
+// Idle periods at least this long go to D1 STOP; shorter ones only WFI.
+// Waking from STOP re-locks PLL1, roughly 100 us, so a short STOP costs
+// more than it saves.
+#define LOW_POWER_STOP_MIN_TICKS 10
+
+typedef enum {
+    LOW_POWER_MODE_SLEEP = 0,   // WFI, clocks running
+    LOW_POWER_MODE_STOP,        // D1 STOP, PLL1 restarted on wake
+    LOW_POWER_MODE_COUNT
+} low_power_mode_t;
+
+typedef struct {
+    uint32_t entries;           // Sleeps actually entered
+    uint32_t slept_ticks;       // Ticks stepped over while in this mode
+    uint32_t early_wakes;       // Woken by an interrupt before the deadline
+} low_power_mode_stats_t;
+
+typedef struct {
+    low_power_mode_stats_t mode[LOW_POWER_MODE_COUNT];
+    uint32_t aborted;               // Task became ready between decision and WFI
+    uint32_t missed_deadlines;      // Woke after the next task was due
+    uint32_t worst_overshoot_ticks;
+    uint32_t last_wake_us;          // STOP exit -> PLL1 back as SYSCLK
+    uint32_t worst_wake_us;
+    uint32_t lptim_hz;              // Calibrated LPTIM1 count rate
+    uint8_t lse_running;
+} low_power_stats_t;
+
+// Telemetry layout: [lse][residency permille u16] then u32 LE fields:
+// sleep entries/ticks/early, stop entries/ticks/early, aborted,
+// missed deadlines, worst overshoot, last wake us, worst wake us, lptim hz
+#define LOW_POWER_REPORT_SIZE (3 + 12 * 4)
+
+// Function prototypes
+void low_power_init(void);
+void low_power_suppress_ticks_and_sleep(uint32_t expected_idle_ticks);
+void low_power_lptim_irq(void);
+void low_power_get_stats(low_power_stats_t *stats);
+uint16_t low_power_residency_permille(void);
+uint16_t low_power_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
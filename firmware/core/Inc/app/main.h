@@ -60,8 +60,16 @@ typedef enum {
     SYS_STATE_COUNT
 } system_state_t;
 
+// Who raised a fault; zero for the polled monitors and tests
+typedef enum {
+    FAULT_SOURCE_MONITOR = 0,
+    FAULT_SOURCE_NETWORK,
+    FAULT_SOURCE_RULE               // fast_rules, from an interrupt
+} fault_source_t;
+
 typedef struct {
     uint8_t predicted_class;
+    uint8_t source;                 // fault_source_t, in what was padding
     float confidence;
     uint32_t timestamp;
 } ml_result_t;
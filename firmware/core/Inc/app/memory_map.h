@@ -0,0 +1,39 @@
+#ifndef __MEMORY_MAP_H
+#define __MEMORY_MAP_H
+
+// Placement of hot code and data in the Cortex-M7 tightly coupled memories.
+// The startup code copies .itcm_text and .dtcm_data and clears .dtcm_bss.
+// Generated and library code (X-CUBE-AI kernels, IRQ handlers, pool0) is
+// selected in the linker scripts instead, so CubeMX regeneration keeps it.
+//
+// DTCM is not reachable by DMA1/DMA2 - use DMA_BUFFER for those.
+//
+// Build with -DMEMORY_MAP_USE_TCM=0 for the flash/AXI SRAM baseline that
+// perf_bench figures are compared against.
+#ifndef MEMORY_MAP_USE_TCM
+#define MEMORY_MAP_USE_TCM 1
+#endif
+
+#if MEMORY_MAP_USE_TCM
+#define ITCM_FUNC __attribute__((section(".itcm_text"), noinline))
+#define DTCM_DATA __attribute__((section(".dtcm_data")))
+#define DTCM_BSS __attribute__((section(".dtcm_bss")))
+#else
+#define ITCM_FUNC
+#define DTCM_DATA
+#define DTCM_BSS
+#endif
+
+// Buffers touched by DMA1/DMA2. They live in D2 SRAM, which the MPU maps
+// non-cacheable, so no cache maintenance is needed around transfers. The
+// section is not cleared at startup. The 32-byte alignment keeps them
+// cache-line safe even if the region is ever made cacheable.
+#define DMA_BUFFER __attribute__((section(".dma_buffer"), aligned(32)))
+
+// Kept across every reset that does not remove power: RAM_D3 (SRAM4),
+// never touched by the startup code. Owners validate it with a magic and
+// a CRC. Cache-line aligned so the D-cache can be cleaned for exactly the
+// object.
+#define RETAINED_RAM __attribute__((section(".retained_ram"), aligned(32)))
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef __ML_ADAPTATION_H
+#define __ML_ADAPTATION_H
+
+#include "main.h"
+#include "ml_integration.h"
+#include "fault_model_kernel.h"
+
+// On-board adaptation of gemm_2, the output layer (8x5 weights and 5
+// biases), to sensor drift. The ground labels the faults the classifier
+// raised; each label goes into a small per-class replay, and every label
+// runs a few SGD passes over that replay plus one anchor per class (the
+// class mean of the standardised training set, so classes the ground has
+// not labelled lately are not forgotten). Every parameter stays within
+// ML_ADAPT_MAX_DELTA of the weights it started from. Hidden layers are
+// never touched. cubesat-fault-predictor/adaptation.py simulates the same
+// update under injected drift and generates the anchors.
+// Build with -DML_ADAPTATION=1 to enable it.
+#ifndef ML_ADAPTATION
+#define ML_ADAPTATION 0
+#endif
+
+#define ML_ADAPT_EVENTS 8                  // Recent faults the ground can label
+#define ML_ADAPT_REPLAY_PER_CLASS 4
+#define ML_ADAPT_EPOCHS 2
+#define ML_ADAPT_LEARNING_RATE 0.02f
+#define ML_ADAPT_MAX_DELTA 1.0f
+
+// Persisted as a log of records in two flash sectors of its own, written
+// from ttc_monitor_task's next pass after the command has been answered.
+// Records go into one sector until it is full, then into the other, which
+// was erased ahead of time. The newest valid one is reloaded at boot if it
+// was made for the same base weights.
+// Not reloaded after a fault, watchdog or unexplained reset until the
+// ground resumes it.
+#define ML_ADAPT_RECORD_MAGIC 0x41445031UL  // "ADP1"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;               // One more for every record written
+    uint32_t base_crc;              // CRC-32 of the weights blob adapted from
+    uint32_t cleared;               // Back to the base weights
+    float output_weights[FAULT_MODEL_OUTPUTS * FAULT_MODEL_HIDDEN2];
+    float output_bias[FAULT_MODEL_OUTPUTS];
+    uint32_t reserved[6];           // Pads to 7 flash words
+    uint32_t crc;                   // CRC-32 of everything above
+} ml_adaptation_record_t;
+
+typedef enum {
+    ML_ADAPT_OFF = 0,               // Built without ML_ADAPTATION
+    ML_ADAPT_BASE,                  // Base weights, nothing learned yet
+    ML_ADAPT_ADAPTED,
+    ML_ADAPT_HELD                   // Persisted adaptation held back after an unsafe reset
+} ml_adaptation_state_t;
+
+typedef enum {
+    ML_ADAPT_STATUS_OK = 0,
+    ML_ADAPT_STATUS_DISABLED,
+    ML_ADAPT_STATUS_BAD_LENGTH,
+    ML_ADAPT_STATUS_UNKNOWN_EVENT,  // Not in the event ring any more, or already labelled
+    ML_ADAPT_STATUS_HELD,           // Resume or reset first
+    ML_ADAPT_STATUS_FLASH_ERROR
+} ml_adaptation_status_t;
+
+typedef enum {
+    ML_ADAPT_CONTROL_RESET = 0,     // Back to the base weights, persisted
+    ML_ADAPT_CONTROL_RESUME         // Load the held adaptation
+} ml_adaptation_control_t;
+
+// Class means of the standardised training features, generated by
+// cubesat-fault-predictor/adaptation.py
+extern const float ml_adaptation_anchors[FAULT_MODEL_OUTPUTS][FAULT_MODEL_INPUTS];
+
+// Telemetry layout: [last status][state][unlabelled events][0], u32 LE
+// version, labels confirming and correcting the classifier, records
+// written and largest parameter change in 0.001, then per event
+// u16 LE id (0 = none), [class, bit 7 once labelled][confidence %]
+#define ML_ADAPT_REPORT_HEADER_SIZE (4 + 5 * 4)
+#define ML_ADAPT_REPORT_ENTRY_SIZE 4
+#define ML_ADAPT_REPORT_SIZE (ML_ADAPT_REPORT_HEADER_SIZE + ML_ADAPT_EVENTS * ML_ADAPT_REPORT_ENTRY_SIZE)
+
+// Function prototypes
+void ml_adaptation_attach(ml_model_t *model, const uint8_t *base);
+void ml_adaptation_note_fault(const float *input, const ml_result_t *result);
+ml_adaptation_status_t ml_adaptation_label(const uint8_t *payload, uint8_t length);
+ml_adaptation_status_t ml_adaptation_control(const uint8_t *payload, uint8_t length);
+void ml_adaptation_service(void);
+void ml_adaptation_golden(const float **input, const float **output);
+uint16_t ml_adaptation_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef __ML_CACHE_H
+#define __ML_CACHE_H
+
+#include "main.h"
+#include "feature_engine.h"
+
+// Classifier results for recently seen inputs. Nominal sensor readings
+// barely move between 100 ms frames, so the network's inputs, quantised
+// to each channel's resolution in feature_schema.h, keep mapping to the
+// same few keys. A direct-mapped table keyed on a hash of the quantised
+// vector returns the stored output instead of running the classifier.
+// Build with -DML_INFERENCE_CACHE=0 to always run it.
+#ifndef ML_INFERENCE_CACHE
+#define ML_INFERENCE_CACHE 1
+#endif
+
+// Table entries, a power of two
+#define ML_CACHE_ENTRIES 16
+
+typedef struct {
+    uint32_t lookups;
+    uint32_t hits;
+    uint32_t bypasses;              // A rule-watched feature on its fault side
+    uint32_t stores;
+    uint32_t invalidations;         // Weights reloaded
+    uint64_t lookup_cycles;
+    uint64_t saved_cycles;          // Classifier cycles of the entries hit
+} ml_cache_stats_t;
+
+// Telemetry layout: u32 LE lookups, hits, bypasses, invalidations, hit
+// rate in 0.01 %, average lookup cycles, classifier cycles saved in
+// thousands, then the signed net saving per lookup in cycles
+#define ML_CACHE_REPORT_SIZE (8 * 4)
+
+// Function prototypes
+void ml_cache_init(void);
+uint8_t ml_cache_lookup(const float *features, float *output);
+void ml_cache_store(const float *output, const ml_result_t *result, uint32_t classifier_cycles);
+void ml_cache_invalidate(void);
+void ml_cache_get_stats(ml_cache_stats_t *stats);
+uint16_t ml_cache_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef __ML_CASCADE_H
+#define __ML_CASCADE_H
+
+#include "main.h"
+#include "fault_model_kernel.h"
+
+// Two-stage inference. The first stage runs on every sample: the novelty
+// forest of novelty_model.h and a tiny anomaly gate, a per-feature Gaussian of nominal operation learned on
+// device from samples the classifier confirmed as normal. The second, the
+// fault_model classifier, only wakes for samples the gate cannot explain
+// or the forest finds novel.
+#define ML_CASCADE_FEATURES FAULT_MODEL_INPUTS
+
+// Classifier runs on every sample until the gate has seen this many
+// confirmed normal ones (10 s at 10Hz)
+#define ML_CASCADE_WARMUP_SAMPLES 100
+// ...and at least every this many samples afterwards, which bounds how
+// long a fault the gate misses can go unclassified (1 s at 10Hz)
+#define ML_CASCADE_REFRESH_SAMPLES 10
+
+// Nominal statistics follow slow drift with an EWMA of 2^-shift
+#define ML_CASCADE_LEARN_SHIFT 6
+#define ML_CASCADE_MIN_VARIANCE 1e-6f
+
+// Wake on a mean squared z-score above ML_CASCADE_WAKE_SCORE, or on any
+// single feature beyond ML_CASCADE_WAKE_Z sigma
+#define ML_CASCADE_WAKE_SCORE 4.0f
+#define ML_CASCADE_WAKE_Z 4.0f
+
+typedef struct {
+    uint32_t samples;
+    uint32_t classifier_runs;
+    uint32_t refresh_runs;          // Woken by warm-up or refresh, not the gate
+    uint64_t novelty_cycles;
+    uint64_t gate_cycles;
+    uint64_t classifier_cycles;
+} ml_cascade_stats_t;
+
+// Telemetry layout: u32 LE samples, classifier runs, refresh runs, gate
+// and classifier average cycles, average cycles per sample over both
+// stages, the signed saving against running the classifier every time in
+// 0.01 %, then the novelty forest's average cycles
+#define ML_CASCADE_REPORT_SIZE (8 * 4)
+
+// Function prototypes
+void ml_cascade_init(void);
+uint8_t ml_cascade_wake(const float *features);
+void ml_cascade_learn(const float *features, const ml_result_t *result);
+void ml_cascade_note(uint8_t classifier_ran, uint32_t novelty_cycles, uint32_t gate_cycles,
+                     uint32_t classifier_cycles);
+void ml_cascade_get_stats(ml_cascade_stats_t *stats);
+uint16_t ml_cascade_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
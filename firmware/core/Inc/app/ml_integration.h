@@ -3,10 +3,74 @@
 
 #include "main.h"
 #include "ai_runtime.h"  // STM32Cube.AI generated header
+#include "fault_model_kernel.h"
 
 #define ML_INPUT_SIZE 32   // Adjust based on your model
 #define ML_OUTPUT_SIZE 5   // 5 fault classes
 
+// A fault is acted on above this softmax confidence
+#define ML_DECISION_CONFIDENCE 0.7f
+
+// Decide on the gemm_2 logits instead of the probabilities: argmax plus
+// the top-1 minus top-2 logit margin, with the softmax only computed for
+// margins inside the band below, or when a blackbox capture is downlinked.
+// Needs the fused kernel, the runtime only exposes probabilities.
+#ifndef ML_SKIP_SOFTMAX
+#define ML_SKIP_SOFTMAX 0
+#endif
+
+#if ML_SKIP_SOFTMAX && !ML_FUSED_KERNEL
+#error "ML_SKIP_SOFTMAX needs ML_FUSED_KERNEL=1"
+#endif
+
+// Margin band around ML_DECISION_CONFIDENCE: ln(0.7/0.3) and
+// ln(4 * 0.7/0.3). Below it even a lone runner-up keeps the top class
+// under 0.7, above it even four cannot pull it below, so the decisions are
+// those of the softmax for any 5-class model and any input. A band fitted
+// to training data would only agree on data like it, so none is used;
+// train_model.py reports how often the softmax is still needed.
+#define ML_DECISION_MARGIN_LOW 0.8472979f
+#define ML_DECISION_MARGIN_HIGH 2.2335922f
+
+// Where ml_model_run_inference's output came from
+typedef enum {
+    ML_OUTPUT_GATED = 0,            // Classifier asleep: a nominal stand-in, not a network output
+    ML_OUTPUT_CLASSIFIER,
+    ML_OUTPUT_CACHED                // A recent classifier output for the same quantised inputs
+} ml_output_origin_t;
+
+typedef enum {
+    ML_MODEL_NOT_LOADED = 0,
+    ML_MODEL_LOADED,
+    ML_MODEL_CREATE_FAILED,         // ai_network_create_and_init, see the ai_error
+    ML_MODEL_SHAPE_MISMATCH,        // Report disagrees with network.h or the pool
+    ML_MODEL_GOLDEN_FAILED          // Bound, but the golden pair does not match
+} ml_model_status_t;
+
+// What the loader bound and how long it took. Sizes in bytes, addresses
+// as the runtime sees them.
+typedef struct {
+    ml_model_status_t status;
+    ai_error error;
+    uint32_t macc;
+    uint32_t nodes;
+    uint32_t signature;             // Generated network signature
+    uint32_t weights_crc;           // CRC-32 of the weights blob bound
+    uint32_t weights_size;
+    uint32_t activations_size;
+    uint32_t weights_address;
+    uint32_t activations_address;
+    uint32_t init_us;               // ai_network_create_and_init
+    uint32_t golden_us;             // Golden pair through the runtime
+    uint32_t golden_error;          // Worst output error, in millionths
+    uint32_t reloads;               // ml_model_load_weights since boot
+    uint32_t reload_us;             // The last of them
+} ml_model_info_t;
+
+// Telemetry layout: [status][ai error type][0][0], u32 LE ai error code,
+// then the ml_model_info_t fields from macc to reload_us
+#define ML_MODEL_REPORT_SIZE (4 + 14 * 4)
+
 typedef struct {
     float input_buffer[ML_INPUT_SIZE];
     float output_buffer[ML_OUTPUT_SIZE];
@@ -16,10 +80,21 @@ typedef struct {
 } ml_model_t;
 
 // ML function prototypes
+void ml_integration_init(void);
+void ml_pipeline_lock(void);
+void ml_pipeline_unlock(void);
 uint8_t ml_model_init(ml_model_t *model);
-uint8_t ml_model_run_inference(ml_model_t *model, float *input_data, float *output_data);
+const uint8_t *ml_model_factory_weights(void);
+uint8_t ml_model_load_weights(ml_model_t *model, const uint8_t *weights);
+uint8_t ml_model_run_inference(ml_model_t *model, float *input_data, float *output_data,
+                               ml_output_origin_t *origin);
+uint8_t ml_model_evaluate(ml_model_t *model, const float *input, float *output);
 void ml_model_deinit(ml_model_t *model);
+void ml_model_get_info(ml_model_info_t *info);
+uint16_t ml_model_build_report(uint8_t *buffer, uint16_t size);
 void collect_ml_input_data(float *input);
 ml_result_t process_ml_output(float *output);
+ml_result_t ml_model_decide(const float *output);
+void ml_output_to_probabilities(float *output);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef __MODEL_UPDATE_H
+#define __MODEL_UPDATE_H
+
+#include "main.h"
+#include "ml_integration.h"
+#include "fault_model_kernel.h"
+#include "flash_write.h"
+
+// Weights-only model updates over the uplink. The last two 128 KiB flash
+// sectors are A/B slots, kept out of the image by the linker script; each
+// holds a header and an image uploaded in chunks:
+//   weights blob (the runtime's layout) | golden input | golden output
+// The golden pair is computed on the ground with tools/model_update.py and
+// checked on board before the weights go live. The newest verified slot
+// runs; the slot being uploaded is never the one running, and a rollback
+// retires the running slot for the other one or the linked-in weights.
+#define MODEL_UPDATE_SLOT_COUNT 2
+#define MODEL_UPDATE_SLOT_A_ADDRESS 0x080C0000UL    // Sector 6
+#define MODEL_UPDATE_SLOT_B_ADDRESS 0x080E0000UL    // Sector 7
+#define MODEL_UPDATE_SLOT_A_SECTOR FLASH_WRITE_MODEL_SLOT_SECTOR
+
+// Layout inside a slot: header, retire word, image, each starting on a
+// flash word
+#define MODEL_UPDATE_HEADER_AT 0
+#define MODEL_UPDATE_RETIRE_AT 64
+#define MODEL_UPDATE_IMAGE_AT 96
+
+#define MODEL_UPDATE_MAGIC 0x4D444C31UL     // "MDL1"
+#define MODEL_UPDATE_HASH_SIZE 16           // model_hash from network_generate_report.txt
+#define MODEL_UPDATE_GOLDEN_INPUT_AT FAULT_MODEL_WEIGHTS_SIZE
+#define MODEL_UPDATE_GOLDEN_OUTPUT_AT (MODEL_UPDATE_GOLDEN_INPUT_AT + FAULT_MODEL_INPUTS * 4)
+#define MODEL_UPDATE_IMAGE_SIZE (MODEL_UPDATE_GOLDEN_OUTPUT_AT + FAULT_MODEL_OUTPUTS * 4)
+
+// model_hash of the linked-in weights, from network_generate_report.txt
+#define MODEL_UPDATE_FACTORY_HASH { \
+    0x6d, 0xe7, 0x81, 0x43, 0x05, 0x48, 0x1b, 0x02, \
+    0x28, 0x5e, 0x7f, 0xfe, 0x80, 0xf5, 0x84, 0x8e }
+
+// Written last, two flash words; header_crc covers everything before it,
+// so a header cut short by a reset reads as an empty slot
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;              // Higher is newer
+    uint32_t image_size;
+    uint32_t image_crc;             // CRC-32 of the image
+    uint8_t model_hash[MODEL_UPDATE_HASH_SIZE];
+    uint32_t reserved[7];
+    uint32_t header_crc;
+} model_update_header_t;
+
+typedef enum {
+    MODEL_UPDATE_OK = 0,
+    MODEL_UPDATE_NOT_READY,         // Network not initialised yet
+    MODEL_UPDATE_BAD_LENGTH,
+    MODEL_UPDATE_BAD_STATE,         // Chunk or commit without a begin, rollback on factory weights
+    MODEL_UPDATE_BAD_OFFSET,        // Chunks must arrive in order
+    MODEL_UPDATE_FLASH_ERROR,
+    MODEL_UPDATE_BAD_CRC,
+    MODEL_UPDATE_GOLDEN_FAIL        // Weights rejected on board, previous ones restored
+} model_update_status_t;
+
+// Slot state in the report; bit 7 set on the running slot
+typedef enum {
+    MODEL_SLOT_EMPTY = 0,           // Erased, partial or corrupt
+    MODEL_SLOT_VALID,
+    MODEL_SLOT_RETIRED              // Rolled back or rejected
+} model_slot_state_t;
+
+#define MODEL_UPDATE_SLOT_RUNNING 0x80
+#define MODEL_UPDATE_FACTORY 0xFF          // Active slot when the linked-in weights run
+
+// Telemetry layout: [last status][active slot][upload slot or 0xFF][0],
+// u32 LE image bytes received and rollbacks, the running model_hash, then
+// per slot [state] u32 LE sequence and image CRC. Also the reply to every
+// model update command.
+#define MODEL_UPDATE_REPORT_HEADER_SIZE (4 + 2 * 4 + MODEL_UPDATE_HASH_SIZE)
+#define MODEL_UPDATE_REPORT_ENTRY_SIZE (1 + 2 * 4)
+#define MODEL_UPDATE_REPORT_SIZE \
+    (MODEL_UPDATE_REPORT_HEADER_SIZE + MODEL_UPDATE_SLOT_COUNT * MODEL_UPDATE_REPORT_ENTRY_SIZE)
+
+// Function prototypes
+void model_update_init(ml_model_t *model);
+model_update_status_t model_update_begin(const uint8_t *payload, uint8_t length);
+model_update_status_t model_update_chunk(const uint8_t *payload, uint8_t length);
+model_update_status_t model_update_commit(void);
+model_update_status_t model_update_rollback(void);
+void model_update_golden(const float **input, const float **output);
+uint16_t model_update_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
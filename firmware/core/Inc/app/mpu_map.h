@@ -0,0 +1,35 @@
+#ifndef __MPU_MAP_H
+#define __MPU_MAP_H
+
+#include "main.h"
+
+// Debug builds linked with STM32H735IGTX_RAM.ld execute from AXI SRAM and
+// must be built with -DMPU_AXI_SRAM_EXEC=1
+#ifndef MPU_AXI_SRAM_EXEC
+#define MPU_AXI_SRAM_EXEC 0
+#endif
+
+// Memory types (ARMv7-M TEX/C/B encoding)
+#define MPU_TYPE_NORMAL_WBWA 1, MPU_ACCESS_CACHEABLE, MPU_ACCESS_BUFFERABLE
+#define MPU_TYPE_NORMAL_NC 1, MPU_ACCESS_NOT_CACHEABLE, MPU_ACCESS_NOT_BUFFERABLE
+#define MPU_TYPE_STRONGLY_ORDERED 0, MPU_ACCESS_NOT_CACHEABLE, MPU_ACCESS_NOT_BUFFERABLE
+
+typedef struct {
+    const char *name;
+    uint32_t base;              // Must be aligned to the region size
+    uint8_t size;               // MPU_REGION_SIZE_*
+    uint8_t subregion_disable;  // One bit per eighth of the region
+    uint8_t tex;                // Memory type, see MPU_TYPE_*
+    uint8_t cacheable;
+    uint8_t bufferable;
+    uint8_t shareable;
+    uint8_t access;             // MPU_REGION_*_ACCESS / MPU_REGION_PRIV_RW ...
+    uint8_t exec;               // MPU_INSTRUCTION_ACCESS_ENABLE / _DISABLE
+} mpu_region_t;
+
+// Function prototypes
+void mpu_map_apply(void);
+uint8_t mpu_map_region_count(void);
+const mpu_region_t *mpu_map_get_region(uint8_t number);
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef __NOVELTY_MODEL_H
+#define __NOVELTY_MODEL_H
+
+#include <stdint.h>
+
+// Isolation forest fitted on normal operation only: samples that isolate
+// in few splits are unlike anything seen in training, whether or not the
+// classifier has a label for them. Same 8 features as the classifier, raw
+// units (trees do not care about scaling).
+#define NOVELTY_MODEL_FEATURES 8
+
+typedef struct {
+    float value;                // Split threshold, or the leaf's path length
+    uint16_t right;             // Right child; the left child is the next node
+    int8_t feature;             // Split feature, -1 for a leaf
+    uint8_t reserved;
+} novelty_node_t;
+
+// Generated by cubesat-fault-predictor/novelty_model.py
+extern const uint16_t novelty_model_tree_count;
+extern const uint16_t novelty_model_node_count;
+extern const float novelty_model_path_norm;         // 1 / (trees * c(max_samples))
+extern const float novelty_model_path_threshold;    // Novel below this path length sum
+extern const uint16_t novelty_model_roots[];
+extern const novelty_node_t novelty_model_nodes[];
+
+// Flash taken by the tables
+#define NOVELTY_MODEL_FLASH_BYTES() \
+    ((uint32_t)novelty_model_node_count * sizeof(novelty_node_t) + \
+     (uint32_t)novelty_model_tree_count * sizeof(uint16_t))
+
+// Function prototypes
+float novelty_forest_score(const float *features);
+float novelty_model_anomaly_score(float path_length);
+uint8_t novelty_model_is_novel(float path_length);
+
+#endif
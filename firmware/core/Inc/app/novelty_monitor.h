@@ -0,0 +1,31 @@
+#ifndef __NOVELTY_MONITOR_H
+#define __NOVELTY_MONITOR_H
+
+#include "main.h"
+
+// Always-on novelty score next to the classifier: the isolation forest
+// runs on every sample, wakes the classifier when a sample is novel and
+// counts the novel samples the classifier still calls normal
+typedef struct {
+    uint32_t samples;
+    uint32_t novel;
+    uint32_t unexplained;           // Novel, yet classified normal
+    uint64_t cycles;
+    uint32_t max_cycles;
+    float last_path_length;
+    float min_path_length;          // Most novel sample so far
+} novelty_stats_t;
+
+// Telemetry layout: u32 LE samples, novel, unexplained, average and
+// worst cycles, last and highest score in 0.0001, table flash bytes and
+// tree count
+#define NOVELTY_REPORT_SIZE (9 * 4)
+
+// Function prototypes
+void novelty_monitor_init(void);
+uint8_t novelty_monitor_sample(const float *features);
+void novelty_monitor_note_unexplained(void);
+void novelty_monitor_get_stats(novelty_stats_t *stats);
+uint16_t novelty_monitor_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef __PERF_BENCH_H
+#define __PERF_BENCH_H
+
+#include "main.h"
+#include "ml_integration.h"
+
+#define PERF_BENCH_INFERENCE_RUNS 100
+#define PERF_BENCH_ISR_RUNS 32
+
+// Telemetry layout: [tcm][fused][valid] then u32 LE fields in struct order
+#define PERF_BENCH_REPORT_SIZE (3 + 11 * 4)
+
+typedef struct {
+    // Boot-time benchmark, scheduler suspended
+    uint32_t inference_min_cycles;
+    uint32_t inference_avg_cycles;
+    uint32_t inference_max_cycles;
+    uint32_t isr_min_cycles;        // NVIC pend -> handler return, round trip
+    uint32_t isr_max_cycles;
+    // Live figures from ml_inference_task
+    uint32_t inference_last_cycles;
+    uint32_t inference_worst_cycles;
+    // Boot-time benchmark of the fused kernel on the same input
+    uint32_t kernel_min_cycles;
+    uint32_t kernel_avg_cycles;
+    uint32_t kernel_max_cycles;
+    uint32_t kernel_max_ulp;        // Largest output difference to the runtime, 0 = bit exact
+    uint8_t tcm_enabled;            // MEMORY_MAP_USE_TCM of this build
+    uint8_t fused_kernel;           // ML_FUSED_KERNEL of this build
+    uint8_t valid;
+} perf_bench_result_t;
+
+// Function prototypes
+void perf_bench_run(ml_model_t *model);
+void perf_bench_note_inference(uint32_t cycles);
+void perf_bench_get(perf_bench_result_t *result);
+uint16_t perf_bench_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
@@ -6,20 +6,67 @@
 // Hardware pin definitions - EXACT MATCH with hardware doc
 #define WDOG_WAKE_PIN GPIO_PIN_6        // PA6
 #define WDOG_WAKE_PORT GPIOA
-#define WDOG_DONE_PIN GPIO_PIN_7        // PA7  
+#define WDOG_DONE_PIN GPIO_PIN_7        // PA7
 #define WDOG_DONE_PORT GPIOA
 #define RESET_OUT_PIN GPIO_PIN_8        // PA8
 #define RESET_OUT_PORT GPIOA
 #define ML_FAULT_PIN GPIO_PIN_5         // PA5
 #define ML_FAULT_PORT GPIOA
 
+// Reset source sense lines on the spare connector pins (both active low)
+#define PWR_SUPERVISOR_PIN GPIO_PIN_11  // PA11 - MAX809L RESET output
+#define PWR_SUPERVISOR_PORT GPIOA
+#define MANUAL_RESET_PIN GPIO_PIN_12    // PA12 - Manual reset button
+#define MANUAL_RESET_PORT GPIOA
+
+// Arbiter timing
+#define RESET_DEBOUNCE_MS 20            // Hardware line must stay asserted this long
+#define RESET_RECOVERY_HOLDOFF_MS 2000  // Quiet time after a reset before re-arming
+#define RESET_ESCALATION_WINDOW_MS 60000 // Resets closer than this escalate
+#define RESET_MAX_STAGES 4
+
+// Reset sources (the four SN7432N inputs plus the fault handler)
+typedef enum {
+    RESET_SRC_WATCHDOG = 0,
+    RESET_SRC_POWER_SUPERVISOR,
+    RESET_SRC_SOFTWARE,
+    RESET_SRC_MANUAL,
+    RESET_SRC_FAULT_HANDLER,
+    RESET_SRC_COUNT
+} reset_source_t;
+
+typedef enum {
+    RESET_STATE_ARMED = 0,
+    RESET_STATE_PENDING,
+    RESET_STATE_SHUTTING_DOWN,
+    RESET_STATE_ASSERTED,
+    RESET_STATE_RECOVERED
+} reset_state_t;
+
+// One escalation stage, selected by how many resets happened in the window
+typedef struct {
+    uint32_t pulse_ms;      // RESET_OUT assertion width
+    uint8_t power_cycle;    // Also drop the PA1-PA4 high-side switches
+    uint8_t self_reset;     // Reset this MCU after releasing RESET_OUT
+} reset_stage_t;
+
+typedef struct {
+    reset_state_t state;
+    uint8_t last_sources;           // Bitmap of reset_source_t that fired
+    uint8_t escalation_level;
+    uint32_t reset_count;
+    uint32_t last_latency_cycles;   // Source assertion -> RESET_OUT high
+    uint32_t worst_latency_cycles;
+    uint32_t last_latency_us;
+} reset_stats_t;
+
 // Function prototypes
 void reset_controller_init(void);
 void reset_control_task(void *argument);
-uint8_t check_watchdog_timeout(void);
-uint8_t check_power_supervisor(void);
-uint8_t check_software_reset_request(void);
-uint8_t check_manual_reset_button(void);
+void reset_control_request(reset_source_t source);
+void reset_control_request_from_isr(reset_source_t source);
+void reset_control_set_escalation(const reset_stage_t *stages, uint8_t count);
+void reset_control_get_stats(reset_stats_t *stats);
 void execute_controlled_shutdown(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,40 @@
+#ifndef __RUNTIME_STATS_H
+#define __RUNTIME_STATS_H
+
+#include "main.h"
+
+// Run-time stats clock: DWT cycles divided by 64 (~4.3 MHz at 275 MHz),
+// which keeps the 32-bit FreeRTOS counters from wrapping for ~16 minutes
+#define RUNTIME_STATS_CLOCK_SHIFT 6
+
+#define RUNTIME_STATS_SAMPLE_PERIOD_MS 1000
+#define RUNTIME_STATS_MAX_TASKS 12
+#define RUNTIME_STATS_NAME_LEN 8
+
+// Telemetry layout: [load u16][heap %][task count] then per task
+// [task number][cpu u16][stack free u16][name, 8 bytes zero padded]
+#define RUNTIME_STATS_REPORT_HEADER_SIZE 4
+#define RUNTIME_STATS_REPORT_ENTRY_SIZE (5 + RUNTIME_STATS_NAME_LEN)
+
+typedef struct {
+    const char *name;
+    uint8_t task_number;
+    uint16_t cpu_permille;      // Share of the last sample window
+    uint32_t stack_free_bytes;  // Stack high-water mark since task creation
+} runtime_stats_task_t;
+
+// FreeRTOS run-time stats hooks (see freertos.c)
+void runtime_stats_timer_init(void);
+uint32_t runtime_stats_counter(void);
+void runtime_stats_account_sleep(uint64_t cycles);
+
+// Function prototypes
+void runtime_stats_sample(void);
+uint8_t runtime_stats_get_task(uint8_t index, runtime_stats_task_t *task);
+uint8_t runtime_stats_task_count(void);
+uint32_t runtime_stats_min_stack_free(void);
+uint16_t runtime_stats_build_report(uint8_t *buffer, uint16_t size);
+float get_cpu_usage_percent(void);
+float get_memory_usage_percent(void);
+
+#endif
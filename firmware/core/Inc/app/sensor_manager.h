@@ -14,6 +14,7 @@ float read_voltage_3v3(void);
 float read_voltage_5v(void);
 float read_current_consumption(void);
 float read_internal_vref(void);
+uint32_t read_vdda_mv(void);
 void update_sensor_readings(void);
 
 // External ADC handles (from CubeMX)
@@ -59,6 +59,9 @@ void I2C1_EV_IRQHandler(void);
 void I2C1_ER_IRQHandler(void);
 void USART1_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void EXTI15_10_IRQHandler(void);
+void LPTIM1_IRQHandler(void);
+void LPTIM2_IRQHandler(void);
 
 /* USER CODE END EFP */
 
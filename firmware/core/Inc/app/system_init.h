@@ -3,8 +3,10 @@
 
 #include "main.h"
 
+// Self test waits this long for the ML model before running without it
+#define BOOT_SELF_TEST_WAIT_MS 5000
+
 void system_startup_sequence(void);
-void enter_diagnostic_mode(void);
-void load_ml_model(void);
+void boot_task(void *argument);
 
-#endif
\ No newline at end of file
+#endif
@@ -3,11 +3,8 @@
 
 #include "main.h"
 
-void run_system_self_test(void);
-void test_led_system(void);
-void test_reset_system(void);
-void test_communication_system(void);
-void test_ml_system(void);
+uint8_t run_system_self_test(void);
+uint8_t test_led_system(void);
 void test_fault_detection(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,41 @@
+#ifndef __TASK_HEALTH_H
+#define __TASK_HEALTH_H
+
+#include "main.h"
+
+// Critical tasks that must check in for the TPL5010 to be kicked
+typedef enum {
+    TASK_HEALTH_ML_INFERENCE = 0,
+    TASK_HEALTH_FAULT_HANDLER,
+    TASK_HEALTH_TTC_MONITOR,
+    TASK_HEALTH_COUNT
+} task_health_id_t;
+
+// Deadlines cover one full loop including its worst blocking call
+#define TASK_HEALTH_ML_DEADLINE_MS 1000     // 100 ms loop + inference
+#define TASK_HEALTH_FAULT_DEADLINE_MS 5000  // Queue wait + power cycle recovery
+#define TASK_HEALTH_TTC_DEADLINE_MS 2000    // 100 ms loop + frame downlink
+
+// Telemetry record, one per task: [id][stale][last u16][worst u16][misses u16]
+#define TASK_HEALTH_REPORT_ENTRY_SIZE 8
+
+typedef struct {
+    const char *name;
+    uint32_t deadline_ms;
+    uint32_t last_checkin;      // Tick of the latest check-in
+    uint32_t last_period_ms;    // Time between the last two check-ins
+    uint32_t worst_period_ms;
+    uint32_t checkins;
+    uint16_t deadline_misses;   // Watchdog cycles where this task was stale
+    uint8_t stale;
+} task_health_entry_t;
+
+// Function prototypes
+void task_health_init(void);
+void task_health_checkin(task_health_id_t id);
+void task_health_excuse(uint32_t ticks);
+uint8_t task_health_all_fresh(uint8_t *stale_mask);
+void task_health_get(task_health_id_t id, task_health_entry_t *entry);
+uint16_t task_health_build_report(uint8_t *buffer, uint16_t size);
+
+#endif
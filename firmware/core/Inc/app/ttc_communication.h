@@ -6,10 +6,57 @@
 #define TTC_BUFFER_SIZE 256
 #define TTC_TIMEOUT_MS 2000
 
+// Good uplink frames per second from the ground station on a healthy
+// link. The classifier's uart_packets_received is counted against it.
+#ifndef TTC_UPLINK_NOMINAL_FRAMES_PER_S
+#define TTC_UPLINK_NOMINAL_FRAMES_PER_S 10
+#endif
+
+// Typed telemetry frames: [sync][frame id][length][payload...][crc8]
+// Status frames carry the system state in byte 1, so typed frame IDs start
+// at 0x80 to stay distinguishable on the ground
+#define TTC_SYNC_BYTE 0xAA
+#define TTC_FRAME_OVERHEAD 4
+#define TTC_FRAME_MAX_PAYLOAD (TTC_BUFFER_SIZE - TTC_FRAME_OVERHEAD)
+
+#define TTC_FRAME_BLACKBOX_HEADER 0x80
+#define TTC_FRAME_BLACKBOX_RECORD 0x81
+#define TTC_FRAME_RESET_REPORT 0x82
+#define TTC_FRAME_TASK_HEALTH 0x83
+#define TTC_FRAME_RUNTIME_STATS 0x84
+#define TTC_FRAME_PERF_BENCH 0x85
+#define TTC_FRAME_POWER_STATS 0x86
+#define TTC_FRAME_CLOCK_MODE 0x87
+#define TTC_FRAME_BOOT_TIMELINE 0x88
+#define TTC_FRAME_BIST_REPORT 0x89
+#define TTC_FRAME_ML_CASCADE 0x8A
+#define TTC_FRAME_NOVELTY 0x8B
+#define TTC_FRAME_MODEL_UPDATE 0x8C
+#define TTC_FRAME_ML_ADAPTATION 0x8D
+#define TTC_FRAME_FAST_RULES 0x8E
+#define TTC_FRAME_ML_CACHE 0x8F
+#define TTC_FRAME_ML_MODEL 0x90
+
+// Uplink commands use the same framing with IDs below 0x80
+#define TTC_UPLINK_MAX_PAYLOAD 64
+#define TTC_CMD_RUN_BIST 0x40           // [test mask], absent = all tests
+// Weights upload, each answered with a TTC_FRAME_MODEL_UPDATE report.
+// BEGIN and ROLLBACK erase a flash sector with USART1 masked for up to
+// seconds: the ground must wait for their report before sending anything
+// else, and bytes sent meanwhile are lost.
+#define TTC_CMD_MODEL_BEGIN 0x41        // [u32 image size][u32 image CRC][model_hash]
+#define TTC_CMD_MODEL_CHUNK 0x42        // [u16 image offset][data...]
+#define TTC_CMD_MODEL_COMMIT 0x43       // Verify, write header, switch
+#define TTC_CMD_MODEL_ROLLBACK 0x44     // Retire the running slot
+// On-board adaptation, each answered with a TTC_FRAME_ML_ADAPTATION report
+#define TTC_CMD_FAULT_LABEL 0x45        // [u16 event id][true class]
+#define TTC_CMD_ADAPT_CONTROL 0x46      // [0 reset to base weights, 1 resume]
+
 typedef struct {
     uint8_t rx_buffer[TTC_BUFFER_SIZE];
     uint8_t tx_buffer[TTC_BUFFER_SIZE];
-    uint16_t rx_index;
+    volatile uint16_t rx_index;     // Written by the RX interrupt
+    uint16_t rx_read_index;         // Next byte for the uplink parser
     uint16_t tx_index;
     uint32_t last_rx_time;
     uint8_t connection_healthy;
@@ -18,8 +65,25 @@ typedef struct {
 void ttc_communication_init(void);
 void ttc_receive_callback(UART_HandleTypeDef *huart);
 void ttc_transmit_data(uint8_t *data, uint16_t length);
+void ttc_send_frame(uint8_t frame_id, const uint8_t *payload, uint8_t length);
+
+// Fills at most size bytes of a typed frame payload, returns the length
+// used (0 if size is too small)
+typedef uint16_t (*ttc_report_builder_t)(uint8_t *buffer, uint16_t size);
+void ttc_send_report(uint8_t frame_id, ttc_report_builder_t build);
+
+// Frame payload fields are little-endian. The put helpers return the byte
+// after the field; ttc_put_u16 saturates at UINT16_MAX.
+uint8_t *ttc_put_u16(uint8_t *buffer, uint32_t value);
+uint8_t *ttc_put_u32(uint8_t *buffer, uint32_t value);
+uint32_t ttc_get_u32(const uint8_t *buffer);
+void send_telemetry_data(void);
+void ttc_process_uplink(void);
+uint8_t ttc_loopback_test(uint32_t *echoed);
 uint8_t ttc_check_connection(void);
+uint32_t ttc_frames_received(void);
 void ttc_monitor_task(void *argument);
-void restart_uart_link(void);
+void ttc_request_link_restart(void);
+void ttc_request_retransmission(void);
 
 #endif
\ No newline at end of file
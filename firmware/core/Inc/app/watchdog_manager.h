@@ -9,11 +9,16 @@
 #define WDOG_DONE_PIN GPIO_PIN_7        // PA7 - Input from watchdog
 #define WDOG_DONE_PORT GPIOA
 
+// WAKE toggle cadence of watchdog_manager_task, and of the flash driver
+// while it has every task parked for a sector erase
+#define WATCHDOG_KICK_INTERVAL_MS 500
+
 // Function prototypes
 void watchdog_manager_init(void);
 void watchdog_manager_task(void *argument);
 uint8_t watchdog_check_timeout(void);
 void watchdog_trigger_reset(void);
 uint32_t watchdog_get_time_since_last_ping(void);
+void watchdog_manager_kick_parked(void);
 
 #endif
\ No newline at end of file
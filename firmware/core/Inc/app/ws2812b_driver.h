@@ -12,7 +12,17 @@
 #define RESET 50000 // Reset time
 
 
-#define NS_TO_CYCLES(ns) ((ns * 80) / 1000)  // 80MHz timer
+// Timer counts for a duration at the current timer clock (see clock_mode.c)
+#define NS_TO_CYCLES(ns, timer_hz) ((uint32_t)(((uint64_t)(ns) * (timer_hz)) / 1000000000U))
+#define WS2812B_DEFAULT_TIMER_HZ 80000000U
+
+// Frame layout: 24 PWM slots per LED, then zero-duty slots for the reset
+// period plus one, since the DMA-complete callback fires while the last
+// slot is still on the wire
+#define WS2812B_NUM_LEDS 3
+#define WS2812B_DATA_SLOTS (WS2812B_NUM_LEDS * 24)
+#define WS2812B_RESET_SLOTS ((RESET + (T0H + T0L) - 1) / (T0H + T0L) + 1)
+#define WS2812B_FRAME_SLOTS (WS2812B_DATA_SLOTS + WS2812B_RESET_SLOTS)
 
 // RGB color structure
 typedef struct {
@@ -22,10 +32,11 @@ typedef struct {
 } ws2812b_color_t;
 
 void ws2812b_init(TIM_HandleTypeDef *htim, uint32_t channel);
+void ws2812b_set_timer_clock(uint32_t timer_hz);
 void ws2812b_set_color(ws2812b_color_t color);
 void ws2812b_set_colors(ws2812b_color_t *colors, uint16_t num_leds);
-void ws2812b_chase_pattern(ws2812b_color_t color, uint16_t num_cycles);
-void ws2812b_breathe_pattern(ws2812b_color_t color, uint16_t duration_ms);
+uint8_t ws2812b_is_busy(void);
+uint32_t ws2812b_frames_superseded(void);
 
 extern const ws2812b_color_t COLOR_NORMAL;
 extern const ws2812b_color_t COLOR_ML_ACTIVE;
@@ -0,0 +1,20 @@
+#ifndef __WS2812B_ENCODE_H
+#define __WS2812B_ENCODE_H
+
+#include <stdint.h>
+
+// Bit encoder for the WS2812B PWM stream. No HAL dependency so the host
+// benchmark (tools/ws2812b_encode_bench.c) builds the same code.
+#define WS2812B_BITS_PER_LED 24
+
+// Compare values for the four bits of every nibble, MSB first, packed
+// so that one 64-bit copy writes four PWM slots
+typedef struct {
+    uint64_t nibble[16];
+} ws2812b_lut_t;
+
+void ws2812b_encode_build_lut(ws2812b_lut_t *lut, uint16_t zero_high, uint16_t one_high);
+void ws2812b_encode_led(const ws2812b_lut_t *lut, uint8_t red, uint8_t green, uint8_t blue,
+                        uint16_t *slots);
+
+#endif
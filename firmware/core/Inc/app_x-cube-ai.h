@@ -70,11 +70,14 @@ typedef struct {
     ai_bool (*ai_data_params_get)(ai_network_params* params);
     ai_bool (*ai_get_report)(ai_handle network, ai_network_report* report);
     ai_error (*ai_create)(ai_handle* network, const ai_buffer* network_config);
+    ai_error (*ai_create_and_init)(ai_handle* network, const ai_handle activations[], const ai_handle weights[]);
     ai_error (*ai_get_error)(ai_handle network);
     ai_handle (*ai_destroy)(ai_handle network);
     ai_bool (*ai_init)(ai_handle network, const ai_network_params* params);
     ai_i32 (*ai_run)(ai_handle network, const ai_buffer* input, ai_buffer* output);
     ai_i32 (*ai_forward)(ai_handle network, const ai_buffer* input);
+    ai_buffer* (*ai_inputs_get)(ai_handle network, ai_u16 *n_buffer);
+    ai_buffer* (*ai_outputs_get)(ai_handle network, ai_u16 *n_buffer);
     ai_handle * activations;
 } ai_network_entry_t;
 
@@ -124,6 +127,22 @@ AI_API_ENTRY
 ai_error ai_mnetwork_create(const char *name,
 ai_handle* network, const ai_buffer* network_config);
 
+/*!
+* @brief Create a neural network and bind it in one call.
+* @ingroup network
+* @details As ai_mnetwork_create followed by ai_mnetwork_init, through the
+* network's own create_and_init. Every network is bound to the shared
+* activations pool of its registry entry; weights, if not NULL, replace
+* the generated weights table.
+* @param name the registered network name
+* @param network an opaque handle to the network context
+* @param weights the weights buffer addresses, or NULL
+* @return an error code reporting the status of the API on exit
+*/
+AI_API_ENTRY
+ai_error ai_mnetwork_create_and_init(const char *name,
+ai_handle* network, const ai_handle weights[]);
+
 /*!
 * @brief Destroy a neural network and frees the allocated memory.
 * @ingroup network
@@ -153,6 +172,32 @@ ai_handle ai_mnetwork_destroy(ai_handle network);
 AI_API_ENTRY
 ai_bool ai_mnetwork_init(ai_handle network);
 
+/*!
+* @brief Rebind a network to other weights of the same topology.
+* @ingroup network
+* @details As @ref ai_mnetwork_init, with the weights buffer addresses
+* given instead of the generated ones. The activations stay in the shared
+* pool.
+* @param network an opaque handle to the network context
+* @param weights the weights buffer addresses, or NULL for the generated ones
+* @return true if the network was correctly initialized, false otherwise
+*/
+AI_API_ENTRY
+ai_bool ai_mnetwork_init_weights(ai_handle network, const ai_handle weights[]);
+
+/*!
+* @brief Get the network's input and output buffers.
+* @ingroup network
+* @param network an opaque handle to the network context
+* @param n_buffer where to store the number of buffers, or NULL
+* @return the buffer array, NULL for an unknown handle
+*/
+AI_API_ENTRY
+ai_buffer* ai_mnetwork_inputs_get(ai_handle network, ai_u16 *n_buffer);
+
+AI_API_ENTRY
+ai_buffer* ai_mnetwork_outputs_get(ai_handle network, ai_u16 *n_buffer);
+
 /*!
 * @brief Run the network and return the output
 * @ingroup network
@@ -0,0 +1,281 @@
+#include "bist.h"
+#include "crc32.h"
+#include "cycle_counter.h"
+#include "boot_timeline.h"
+#include "ml_integration.h"
+#include "model_update.h"
+#include "ml_adaptation.h"
+#include "fault_detection.h"
+#include "sensor_manager.h"
+#include "ttc_communication.h"
+#include "watchdog_manager.h"
+#include "i2c.h"
+#include "cmsis_os.h"
+
+// Erased-flash value: tools/image_crc.py has not patched this image
+#define BIST_IMAGE_CRC_UNSET 0xFFFFFFFFUL
+
+// 7-bit addresses outside the reserved ranges
+#define BIST_I2C_FIRST_ADDRESS 0x08
+#define BIST_I2C_LAST_ADDRESS 0x77
+
+// CRC-32 of everything in flash from _simage up to this word, patched in
+// after linking (see the .image_crc section in the linker script)
+__attribute__((section(".image_crc"), used))
+const uint32_t bist_image_crc = BIST_IMAGE_CRC_UNSET;
+
+// Linker script symbols
+extern const uint8_t _simage[];
+extern const uint8_t _sitcm[];
+extern const uint8_t _eitcm[];
+extern const uint8_t _siitcm[];
+
+// From tools/golden_vector.py - regenerate with the network
+static const float golden_input[BIST_GOLDEN_INPUT_SIZE] = {
+    0.7500000f, -0.2500000f, 0.7500000f, 0.0000000f, 0.0000000f, 0.2500000f, 0.7500000f, 1.2500000f,
+};
+static const float golden_output[BIST_GOLDEN_OUTPUT_SIZE] = {
+    0.2536521f, 0.2045886f, 0.1848050f, 0.1387026f, 0.2182517f,
+};
+
+typedef bist_status_t (*bist_test_fn_t)(uint32_t *detail);
+
+static bist_report_t report;
+static uint8_t bist_running = 0;
+
+// detail: CRC-32 computed over the image
+static bist_status_t bist_flash_crc(uint32_t *detail) {
+    // Volatile read, or the compiler folds in the unpatched initialiser
+    uint32_t expected = *(const volatile uint32_t *)&bist_image_crc;
+    uint32_t length = (uint32_t)((const uint8_t *)&bist_image_crc - _simage);
+
+    *detail = crc32_compute(_simage, length);
+
+    if (expected == BIST_IMAGE_CRC_UNSET) {
+        return BIST_SKIPPED;
+    }
+    return (*detail == expected) ? BIST_PASS : BIST_FAIL;
+}
+
+// detail: CRC-32 of the ITCM code as it runs
+static bist_status_t bist_ram_crc(uint32_t *detail) {
+    uint32_t length = (uint32_t)(_eitcm - _sitcm);
+
+    *detail = crc32_compute(_sitcm, length);
+    return (*detail == crc32_compute(_siitcm, length)) ? BIST_PASS : BIST_FAIL;
+}
+
+// detail: VDDA in mV
+static bist_status_t bist_adc_vref(uint32_t *detail) {
+    // ml_inference_task samples the same ADC
+    ml_pipeline_lock();
+    *detail = read_vdda_mv();
+    ml_pipeline_unlock();
+
+    if (*detail < BIST_VDDA_MIN_MV || *detail > BIST_VDDA_MAX_MV) {
+        return BIST_FAIL;
+    }
+    return BIST_PASS;
+}
+
+// detail: pattern bytes echoed correctly
+static bist_status_t bist_uart_loopback(uint32_t *detail) {
+    return ttc_loopback_test(detail) ? BIST_PASS : BIST_FAIL;
+}
+
+// detail: [15:8] lowest responding address, [7:0] devices responding
+static bist_status_t bist_i2c_probe(uint32_t *detail) {
+    uint32_t found = 0;
+    uint32_t first = 0;
+
+    *detail = 0;
+
+    // SDA or SCL held low by a hung device
+    if (hi2c1.Instance->ISR & I2C_ISR_BUSY) {
+        return BIST_FAIL;
+    }
+
+    for (uint16_t address = BIST_I2C_FIRST_ADDRESS; address <= BIST_I2C_LAST_ADDRESS; address++) {
+        HAL_StatusTypeDef status = HAL_I2C_IsDeviceReady(&hi2c1, (uint16_t)(address << 1), 1, 2);
+
+        if (status == HAL_OK) {
+            if (found++ == 0) {
+                first = address;
+            }
+        } else if (status == HAL_BUSY ||
+                   (hi2c1.ErrorCode & (HAL_I2C_ERROR_BERR | HAL_I2C_ERROR_ARLO))) {
+            *detail = (first << 8) | found;
+            return BIST_FAIL;
+        }
+    }
+
+    *detail = (first << 8) | found;
+    return BIST_PASS;
+}
+
+// The pair for the weights linked into the image; the model loader
+// checks the freshly bound network against it too
+void bist_golden_vector(const float **input, const float **output) {
+    *input = golden_input;
+    *output = golden_output;
+}
+
+// Worst absolute error over the softmax outputs
+float bist_golden_error(const float *output, const float *expected) {
+    float worst = 0.0f;
+
+    for (int i = 0; i < BIST_GOLDEN_OUTPUT_SIZE; i++) {
+        float error = output[i] - expected[i];
+        if (error < 0.0f) {
+            error = -error;
+        }
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    return worst;
+}
+
+// detail: worst absolute output error, in millionths
+static bist_status_t bist_golden_inference(uint32_t *detail) {
+    float output[BIST_GOLDEN_OUTPUT_SIZE];
+    const float *input = golden_input;
+    const float *expected = golden_output;
+
+    *detail = 0;
+
+    if (!boot_timeline_ok(BOOT_STEP_ML_MODEL)) {
+        return BIST_SKIPPED;
+    }
+
+    // Uploaded weights bring their own pair, adapted ones the output
+    // recorded when they last changed
+    ml_pipeline_lock();
+    model_update_golden(&input, &expected);
+    ml_adaptation_golden(&input, &expected);
+    uint8_t ran = ml_model_evaluate(ml_inference_model(), input, output);
+    ml_pipeline_unlock();
+
+    if (!ran) {
+        return BIST_FAIL;
+    }
+
+    float worst = bist_golden_error(output, expected);
+    *detail = (uint32_t)(worst * 1000000.0f);
+    return (worst <= BIST_GOLDEN_TOLERANCE) ? BIST_PASS : BIST_FAIL;
+}
+
+// detail: bit 0 WAKE driven, bit 1 WAKE read back, bit 2 DONE
+static bist_status_t bist_watchdog_line(uint32_t *detail) {
+    // watchdog_manager_task toggles WAKE; sample latch and pin together
+    taskENTER_CRITICAL();
+    uint32_t driven = (WDOG_WAKE_PORT->ODR & WDOG_WAKE_PIN) ? 1 : 0;
+    uint32_t pin = (HAL_GPIO_ReadPin(WDOG_WAKE_PORT, WDOG_WAKE_PIN) == GPIO_PIN_SET) ? 1 : 0;
+    uint32_t done = (HAL_GPIO_ReadPin(WDOG_DONE_PORT, WDOG_DONE_PIN) == GPIO_PIN_SET) ? 1 : 0;
+    taskEXIT_CRITICAL();
+
+    *detail = driven | (pin << 1) | (done << 2);
+    return (pin == driven && !done) ? BIST_PASS : BIST_FAIL;
+}
+
+static const bist_test_fn_t tests[BIST_TEST_COUNT] = {
+    [BIST_TEST_FLASH_CRC] = bist_flash_crc,
+    [BIST_TEST_RAM_CRC] = bist_ram_crc,
+    [BIST_TEST_ADC_VREF] = bist_adc_vref,
+    [BIST_TEST_UART_LOOPBACK] = bist_uart_loopback,
+    [BIST_TEST_I2C_PROBE] = bist_i2c_probe,
+    [BIST_TEST_GOLDEN_INFERENCE] = bist_golden_inference,
+    [BIST_TEST_WATCHDOG_LINE] = bist_watchdog_line,
+};
+
+// Runs the selected tests in the calling task. Returns 1 when none of
+// them failed, 0 on a failure or if another run is in progress.
+uint8_t bist_run(bist_trigger_t trigger, uint8_t test_mask) {
+    bist_report_t result;
+    uint8_t passed = 1;
+
+    taskENTER_CRITICAL();
+    if (bist_running) {
+        taskEXIT_CRITICAL();
+        return 0;
+    }
+    bist_running = 1;
+    result = report;
+    taskEXIT_CRITICAL();
+
+    result.trigger = trigger;
+    result.total_us = 0;
+
+    for (int i = 0; i < BIST_TEST_COUNT; i++) {
+        bist_result_t *test = &result.tests[i];
+
+        if (!(test_mask & (1U << i))) {
+            test->status = BIST_NOT_RUN;
+            test->detail = 0;
+            test->duration_us = 0;
+            continue;
+        }
+
+        uint32_t start = cycle_counter_now();
+        test->status = tests[i](&test->detail);
+        test->duration_us = CYCLES_TO_US(cycle_counter_now() - start);
+        result.total_us += test->duration_us;
+
+        if (test->status == BIST_FAIL) {
+            passed = 0;
+        }
+    }
+
+    result.run_count++;
+    result.finished_tick = osKernelGetTickCount();
+
+    taskENTER_CRITICAL();
+    report = result;
+    bist_running = 0;
+    taskEXIT_CRITICAL();
+
+    return passed;
+}
+
+void bist_get_report(bist_report_t *out) {
+    taskENTER_CRITICAL();
+    *out = report;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t bist_build_report(uint8_t *buffer, uint16_t size) {
+    bist_report_t snapshot;
+    uint8_t passed = 0;
+    uint8_t failed = 0;
+    uint8_t skipped = 0;
+
+    if (size < BIST_REPORT_SIZE) {
+        return 0;
+    }
+
+    bist_get_report(&snapshot);
+
+    for (int i = 0; i < BIST_TEST_COUNT; i++) {
+        uint8_t *entry = &buffer[BIST_REPORT_HEADER_SIZE + i * BIST_REPORT_ENTRY_SIZE];
+
+        switch (snapshot.tests[i].status) {
+            case BIST_PASS:    passed |= (uint8_t)(1U << i); break;
+            case BIST_FAIL:    failed |= (uint8_t)(1U << i); break;
+            case BIST_SKIPPED: skipped |= (uint8_t)(1U << i); break;
+            default: break;
+        }
+
+        entry[0] = (uint8_t)snapshot.tests[i].status;
+        ttc_put_u32(&entry[1], snapshot.tests[i].detail);
+        ttc_put_u32(&entry[5], snapshot.tests[i].duration_us);
+    }
+
+    buffer[0] = (uint8_t)snapshot.trigger;
+    buffer[1] = passed;
+    buffer[2] = failed;
+    buffer[3] = skipped;
+    ttc_put_u32(&buffer[4], snapshot.run_count);
+    ttc_put_u32(&buffer[8], snapshot.total_us);
+
+    return BIST_REPORT_SIZE;
+}
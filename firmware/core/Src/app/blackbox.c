@@ -0,0 +1,215 @@
+#include "blackbox.h"
+#include "ttc_communication.h"
+#include "ml_integration.h"
+#include "cmsis_os.h"
+#include "memory_map.h"
+#include "crc32.h"
+#include <stddef.h>
+#include <string.h>
+
+// Frames sent per ttc_monitor_task cycle while a capture is downlinked
+#define BLACKBOX_FRAMES_PER_SERVICE 4
+
+// Rings live in DTCM: zero wait-state and outside the AXI SRAM the rest of
+// the application uses, so continuous recording costs only a short copy
+static blackbox_ring_t blackbox_rings[2] DTCM_BSS __attribute__((aligned(4)));
+
+// The live ring is written every inference cycle. On a fault it is swapped
+// with the spare one and held as the capture until it has been downlinked.
+static blackbox_ring_t *live_ring = &blackbox_rings[0];
+static blackbox_ring_t *capture_ring = NULL;
+static blackbox_capture_info_t capture_info;
+
+// The held capture as it survives a warm reset
+typedef struct {
+    uint32_t magic;
+    blackbox_capture_info_t info;
+    blackbox_ring_t ring;
+    uint32_t crc;                   // CRC-32 over everything above
+} blackbox_retained_t;
+
+static blackbox_retained_t retained RETAINED_RAM;
+
+// Downlink progress for the held capture
+static uint8_t downlink_header_sent = 0;
+static uint16_t downlink_index = 0;
+
+static uint32_t blackbox_retained_crc(void) {
+    return crc32_compute(&retained, offsetof(blackbox_retained_t, crc));
+}
+
+// Copy a held ring and its info to retained RAM. D3 SRAM is non-cacheable
+// (mpu_map.c); the clean only matters if that mapping is ever changed.
+static void blackbox_retain(const blackbox_ring_t *ring, const blackbox_capture_info_t *info) {
+    retained.magic = 0;
+    retained.ring = *ring;
+    retained.info = *info;
+    retained.crc = blackbox_retained_crc();
+    retained.magic = BLACKBOX_RETAINED_MAGIC;
+    SCB_CleanDCache_by_Addr((uint32_t *)&retained, sizeof(retained));
+}
+
+void blackbox_init(void) {
+    // Also cleared by the startup code; repeated here for re-initialisation
+    memset(blackbox_rings, 0, sizeof(blackbox_rings));
+    memset(&capture_info, 0, sizeof(capture_info));
+
+    live_ring = &blackbox_rings[0];
+    capture_ring = NULL;
+    downlink_header_sent = 0;
+    downlink_index = 0;
+
+    // A capture the previous run froze but never downlinked is held again
+    if (retained.magic == BLACKBOX_RETAINED_MAGIC && retained.crc == blackbox_retained_crc() &&
+        retained.ring.count <= BLACKBOX_DEPTH && retained.ring.head < BLACKBOX_DEPTH) {
+        capture_info = retained.info;
+        capture_info.previous_boot = 1;
+        capture_ring = &retained.ring;
+    } else {
+        retained.magic = 0;
+    }
+}
+
+// The classifier's outputs, or the nominal stand-in when the gate let it
+// sleep; origin tells them apart on the ground
+ITCM_FUNC void blackbox_record(const float *features, const float *outputs, const ml_result_t *result,
+                               ml_output_origin_t origin) {
+    // Copy under a critical section so a concurrent freeze never captures a
+    // half-written record
+    taskENTER_CRITICAL();
+
+    blackbox_record_t *record = &live_ring->records[live_ring->head];
+    record->timestamp = result->timestamp;
+    memcpy(record->features, features, sizeof(record->features));
+    memcpy(record->outputs, outputs, sizeof(record->outputs));
+    record->predicted_class = result->predicted_class;
+    record->system_state = (uint8_t)current_system_state;
+    record->origin = (uint8_t)origin;
+    record->reserved = 0;
+
+    live_ring->head = (live_ring->head + 1) % BLACKBOX_DEPTH;
+    if (live_ring->count < BLACKBOX_DEPTH) {
+        live_ring->count++;
+    }
+
+    taskEXIT_CRITICAL();
+}
+
+ITCM_FUNC uint8_t blackbox_freeze(const ml_result_t *trigger) {
+    uint8_t frozen = 0;
+
+    taskENTER_CRITICAL();
+
+    if (capture_ring == NULL) {
+        // Pointer swap: O(1) in the fault path, no history is copied
+        capture_ring = live_ring;
+        live_ring = (live_ring == &blackbox_rings[0]) ? &blackbox_rings[1] : &blackbox_rings[0];
+        live_ring->head = 0;
+        live_ring->count = 0;
+
+        capture_info.trigger = *trigger;
+        capture_info.freeze_time = osKernelGetTickCount();
+        capture_info.record_count = capture_ring->count;
+        capture_info.previous_boot = 0;
+
+        downlink_header_sent = 0;
+        downlink_index = 0;
+        frozen = 1;
+    } else {
+        // Keep the first capture: it holds the context of the original fault
+        capture_info.dropped_triggers++;
+    }
+
+    taskEXIT_CRITICAL();
+
+    // The recorder writes the other ring now, so the held one is copied
+    // outside the critical section
+    if (frozen) {
+        blackbox_retain(capture_ring, &capture_info);
+    }
+
+    return frozen;
+}
+
+// From the HardFault handler, just before the reset: the live history
+// becomes the held capture if none is. No kernel calls.
+void blackbox_retain_on_crash(void) {
+    blackbox_capture_info_t info = {0};
+
+    if (capture_ring != NULL || live_ring->count == 0) {
+        return;
+    }
+
+    uint16_t newest = (uint16_t)((live_ring->head + BLACKBOX_DEPTH - 1) % BLACKBOX_DEPTH);
+    info.freeze_time = live_ring->records[newest].timestamp;
+    info.record_count = live_ring->count;
+    blackbox_retain(live_ring, &info);
+}
+
+uint8_t blackbox_has_capture(void) {
+    return capture_ring != NULL;
+}
+
+uint8_t blackbox_get_capture_record(uint16_t index, blackbox_record_t *record) {
+    if (capture_ring == NULL || index >= capture_ring->count) {
+        return 0;
+    }
+
+    // Index 0 is the oldest record in the capture
+    uint16_t oldest = (capture_ring->head + BLACKBOX_DEPTH - capture_ring->count) % BLACKBOX_DEPTH;
+    *record = capture_ring->records[(oldest + index) % BLACKBOX_DEPTH];
+    return 1;
+}
+
+void blackbox_get_capture_info(blackbox_capture_info_t *info) {
+    taskENTER_CRITICAL();
+    *info = capture_info;
+    taskEXIT_CRITICAL();
+}
+
+void blackbox_release_capture(void) {
+    taskENTER_CRITICAL();
+    retained.magic = 0;
+    capture_ring = NULL;
+    capture_info.dropped_triggers = 0;
+    taskEXIT_CRITICAL();
+}
+
+void blackbox_service_downlink(void) {
+    uint8_t payload[sizeof(blackbox_record_t) + 2];
+
+    for (int frame = 0; frame < BLACKBOX_FRAMES_PER_SERVICE; frame++) {
+        if (!blackbox_has_capture()) {
+            return;
+        }
+
+        if (!downlink_header_sent) {
+            blackbox_capture_info_t info;
+            blackbox_get_capture_info(&info);
+
+            payload[0] = info.trigger.predicted_class;
+            memcpy(&payload[1], &info.trigger.confidence, sizeof(float));
+            memcpy(&payload[5], &info.trigger.timestamp, sizeof(uint32_t));
+            memcpy(&payload[9], &info.freeze_time, sizeof(uint32_t));
+            memcpy(&payload[13], &info.record_count, sizeof(uint16_t));
+            memcpy(&payload[15], &info.dropped_triggers, sizeof(uint16_t));
+            payload[17] = info.previous_boot;
+
+            ttc_send_frame(TTC_FRAME_BLACKBOX_HEADER, payload, 18);
+            downlink_header_sent = 1;
+            continue;
+        }
+
+        blackbox_record_t record;
+        if (blackbox_get_capture_record(downlink_index, &record)) {
+            ml_output_to_probabilities(record.outputs);
+            memcpy(&payload[0], &downlink_index, sizeof(uint16_t));
+            memcpy(&payload[2], &record, sizeof(record));
+            ttc_send_frame(TTC_FRAME_BLACKBOX_RECORD, payload, sizeof(payload));
+            downlink_index++;
+        } else {
+            // Whole capture sent - re-arm for the next fault
+            blackbox_release_capture();
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#include "boot_timeline.h"
+#include "cycle_counter.h"
+#include "memory_map.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+// What every step needs finished before it may start
+static const uint16_t step_depends[BOOT_STEP_COUNT] = {
+    [BOOT_STEP_MAIN] = 0,
+    [BOOT_STEP_CLOCKS] = BOOT_STEP_BIT(BOOT_STEP_MAIN),
+    [BOOT_STEP_PERIPHERALS] = BOOT_STEP_BIT(BOOT_STEP_CLOCKS),
+    [BOOT_STEP_SUBSYSTEMS] = BOOT_STEP_BIT(BOOT_STEP_PERIPHERALS),
+    [BOOT_STEP_SCHEDULER] = BOOT_STEP_BIT(BOOT_STEP_SUBSYSTEMS),
+    [BOOT_STEP_ML_MODEL] = BOOT_STEP_BIT(BOOT_STEP_SCHEDULER),
+    [BOOT_STEP_DETECTION] = BOOT_STEP_BIT(BOOT_STEP_ML_MODEL),
+    [BOOT_STEP_LOW_POWER] = BOOT_STEP_BIT(BOOT_STEP_SCHEDULER),
+    // Checks the live network instead of creating a second one on the
+    // same activation buffer
+    [BOOT_STEP_SELF_TEST] = BOOT_STEP_BIT(BOOT_STEP_ML_MODEL),
+};
+
+static boot_timeline_t timeline;
+
+// Time is accumulated per segment at the clock the segment started on:
+// the first one runs on HSI, the rest at whatever clock_mode selected
+static uint32_t last_cycles = 0;
+static uint32_t last_hz = 0;
+static uint32_t elapsed_us = 0;
+
+static osEventFlagsId_t boot_flags = NULL;
+static StaticEventGroup_t boot_flags_cb DTCM_BSS;
+
+static const osEventFlagsAttr_t boot_flags_attributes = {
+    .name = "BootFlags",
+    .cb_mem = &boot_flags_cb,
+    .cb_size = sizeof(StaticEventGroup_t),
+};
+
+void boot_timeline_init(void) {
+    memset(&timeline, 0, sizeof(timeline));
+    boot_flags = NULL;
+
+    last_cycles = cycle_counter_now();
+    last_hz = SystemCoreClock;
+    elapsed_us = 0;
+
+    timeline.done = BOOT_STEP_BIT(BOOT_STEP_MAIN);
+}
+
+// Called from MX_FREERTOS_Init. Steps finished before the kernel existed
+// are published at once so no waiter misses them.
+void boot_timeline_start(void) {
+    boot_flags = osEventFlagsNew(&boot_flags_attributes);
+    if (boot_flags == NULL) {
+        Error_Handler();
+    }
+    osEventFlagsSet(boot_flags, timeline.done);
+}
+
+void boot_timeline_mark(boot_step_t step) {
+    if (step >= BOOT_STEP_COUNT) {
+        return;
+    }
+
+    // PRIMASK rather than a kernel critical section: main() marks steps
+    // before the scheduler starts
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t now = cycle_counter_now();
+    elapsed_us += (now - last_cycles) / (last_hz / 1000000U);
+    last_cycles = now;
+    last_hz = SystemCoreClock;
+
+    timeline.step_us[step] = elapsed_us;
+    timeline.done |= (uint16_t)BOOT_STEP_BIT(step);
+    __set_PRIMASK(primask);
+
+    if (boot_flags != NULL) {
+        osEventFlagsSet(boot_flags, BOOT_STEP_BIT(step));
+    }
+}
+
+// A failed step still completes, so its dependants are released and can
+// check boot_timeline_ok themselves
+void boot_timeline_fail(boot_step_t step) {
+    if (step >= BOOT_STEP_COUNT) {
+        return;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    timeline.failed |= (uint16_t)BOOT_STEP_BIT(step);
+    __set_PRIMASK(primask);
+
+    boot_timeline_mark(step);
+}
+
+uint8_t boot_timeline_wait(boot_step_t step, uint32_t timeout) {
+    if (step >= BOOT_STEP_COUNT) {
+        return 0;
+    }
+
+    uint32_t depends = step_depends[step];
+    if ((timeline.done & depends) == depends) {
+        return 1;
+    }
+    if (boot_flags == NULL) {
+        return 0;
+    }
+
+    uint32_t flags = osEventFlagsWait(boot_flags, depends, osFlagsWaitAll | osFlagsNoClear, timeout);
+    return (flags & osFlagsError) == 0;
+}
+
+uint8_t boot_timeline_ok(boot_step_t step) {
+    if (step >= BOOT_STEP_COUNT) {
+        return 0;
+    }
+
+    return (timeline.done & BOOT_STEP_BIT(step)) && !(timeline.failed & BOOT_STEP_BIT(step));
+}
+
+void boot_timeline_get(boot_timeline_t *out) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *out = timeline;
+    __set_PRIMASK(primask);
+}
+
+uint16_t boot_timeline_build_report(uint8_t *buffer, uint16_t size) {
+    boot_timeline_t snapshot;
+
+    if (size < BOOT_TIMELINE_REPORT_SIZE) {
+        return 0;
+    }
+
+    boot_timeline_get(&snapshot);
+
+    uint8_t detection_done = (snapshot.done & BOOT_STEP_BIT(BOOT_STEP_DETECTION)) != 0;
+
+    ttc_put_u16(&buffer[0], snapshot.done);
+    ttc_put_u16(&buffer[2], snapshot.failed);
+    buffer[4] = detection_done &&
+                snapshot.step_us[BOOT_STEP_DETECTION] <= BOOT_DETECTION_BUDGET_US;
+    for (int i = 0; i < BOOT_STEP_COUNT; i++) {
+        ttc_put_u32(&buffer[5 + i * 4], snapshot.step_us[i]);
+    }
+
+    return BOOT_TIMELINE_REPORT_SIZE;
+}
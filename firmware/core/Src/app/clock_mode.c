@@ -0,0 +1,208 @@
+#include "clock_mode.h"
+#include "cycle_counter.h"
+#include "ws2812b_driver.h"
+#include "i2c.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+// Switch cost is dominated by the VOSRDY wait, which always runs at the
+// monitoring clock (voltage goes up before speeding up, down after
+// slowing down), so cycles are converted at that rate
+#define CLOCK_MODE_MONITOR_CPU_HZ 68750000U
+
+#define CLOCK_TYPES (RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | \
+                     RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2 | \
+                     RCC_CLOCKTYPE_D3PCLK1 | RCC_CLOCKTYPE_D1PCLK1)
+
+// USART1 (HSI) and ADC1 (PLL2) have kernel clocks independent of these
+// profiles; I2C1 and the APB1 timers are re-derived on every switch
+static const clock_profile_t profiles[CLOCK_MODE_COUNT] = {
+    [CLOCK_MODE_MONITOR] = {
+        .voltage_scale = PWR_REGULATOR_VOLTAGE_SCALE3,
+        .clocks = {
+            .ClockType = CLOCK_TYPES,
+            .SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK,
+            .SYSCLKDivider = RCC_SYSCLK_DIV4,       // 68.75 MHz CPU and AXI
+            .AHBCLKDivider = RCC_HCLK_DIV1,
+            .APB3CLKDivider = RCC_APB3_DIV2,        // 34.4 MHz APBs
+            .APB1CLKDivider = RCC_APB1_DIV2,
+            .APB2CLKDivider = RCC_APB2_DIV2,
+            .APB4CLKDivider = RCC_APB4_DIV2,
+        },
+        .flash_latency = FLASH_LATENCY_1,
+        .i2c1_timing = 0x10404464,
+    },
+    [CLOCK_MODE_PERFORMANCE] = {
+        // Same as SystemClock_Config
+        .voltage_scale = PWR_REGULATOR_VOLTAGE_SCALE0,
+        .clocks = {
+            .ClockType = CLOCK_TYPES,
+            .SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK,
+            .SYSCLKDivider = RCC_SYSCLK_DIV1,       // 275 MHz CPU and AXI
+            .AHBCLKDivider = RCC_HCLK_DIV1,
+            .APB3CLKDivider = RCC_APB3_DIV2,        // 137.5 MHz APBs
+            .APB1CLKDivider = RCC_APB1_DIV2,
+            .APB2CLKDivider = RCC_APB2_DIV2,
+            .APB4CLKDivider = RCC_APB4_DIV2,
+        },
+        .flash_latency = FLASH_LATENCY_3,
+        .i2c1_timing = 0x60404E72,
+    },
+};
+
+static clock_mode_stats_t stats;
+static uint32_t reason_tick[CLOCK_REASON_COUNT];
+static uint32_t mode_entered_tick = 0;
+
+static void clock_mode_apply(const clock_profile_t *profile, uint8_t voltage_first) {
+    if (voltage_first) {
+        __HAL_PWR_VOLTAGESCALING_CONFIG(profile->voltage_scale);
+        while (!__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY)) {}
+    }
+
+    // Also updates SystemCoreClock and re-derives the SysTick reload
+    RCC_ClkInitTypeDef clocks = profile->clocks;
+    if (HAL_RCC_ClockConfig(&clocks, profile->flash_latency) != HAL_OK) {
+        Error_Handler();
+    }
+
+    if (!voltage_first) {
+        __HAL_PWR_VOLTAGESCALING_CONFIG(profile->voltage_scale);
+        while (!__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY)) {}
+    }
+
+    hi2c1.Init.Timing = profile->i2c1_timing;
+    if (HAL_I2C_Init(&hi2c1) != HAL_OK) {
+        Error_Handler();
+    }
+}
+
+static void clock_mode_switch(clock_mode_t target) {
+    uint32_t now = osKernelGetTickCount();
+
+    // No task may run on half-changed clocks; interrupts stay enabled so
+    // the HAL timeouts keep counting
+    vTaskSuspendAll();
+
+    if (target == stats.mode) {
+        xTaskResumeAll();
+        return;
+    }
+
+    // A task was preempted mid-transfer - retry from clock_mode_service
+    if (HAL_I2C_GetState(&hi2c1) != HAL_I2C_STATE_READY) {
+        stats.deferred++;
+        xTaskResumeAll();
+        return;
+    }
+
+    uint32_t start = cycle_counter_now();
+    clock_mode_apply(&profiles[target], target == CLOCK_MODE_PERFORMANCE);
+    uint32_t cycles = cycle_counter_now() - start;
+
+    stats.ticks_in_mode[stats.mode] += now - mode_entered_tick;
+    mode_entered_tick = now;
+    stats.mode = target;
+    stats.switches[target]++;
+    stats.last_switch_cycles = cycles;
+    stats.last_switch_us = cycles / (CLOCK_MODE_MONITOR_CPU_HZ / 1000000U);
+    if (stats.last_switch_us > stats.worst_switch_us) {
+        stats.worst_switch_us = stats.last_switch_us;
+    }
+
+    xTaskResumeAll();
+
+    // WS2812B bit timing follows the APB1 timer clock
+    ws2812b_set_timer_clock(clock_mode_timer_clock_hz());
+}
+
+void clock_mode_init(void) {
+    memset(&stats, 0, sizeof(stats));
+
+    // SystemClock_Config leaves us in the performance profile; stay there
+    // through boot and the self tests
+    stats.mode = CLOCK_MODE_PERFORMANCE;
+    mode_entered_tick = osKernelGetTickCount();
+    reason_tick[CLOCK_REASON_BOOT] = mode_entered_tick;
+    stats.reasons = 1U << CLOCK_REASON_BOOT;
+
+    ws2812b_set_timer_clock(clock_mode_timer_clock_hz());
+}
+
+void clock_mode_request(clock_reason_t reason) {
+    if (reason >= CLOCK_REASON_COUNT) {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    reason_tick[reason] = osKernelGetTickCount();
+    stats.reasons |= (uint8_t)(1U << reason);
+    taskEXIT_CRITICAL();
+
+    // Escalate right away: the anomaly path should not wait for the
+    // next service call
+    clock_mode_switch(CLOCK_MODE_PERFORMANCE);
+}
+
+void clock_mode_service(void) {
+    uint32_t now = osKernelGetTickCount();
+
+    taskENTER_CRITICAL();
+    for (int i = 0; i < CLOCK_REASON_COUNT; i++) {
+        if ((stats.reasons & (1U << i)) &&
+            (now - reason_tick[i]) > pdMS_TO_TICKS(CLOCK_MODE_HOLD_MS)) {
+            stats.reasons &= (uint8_t)~(1U << i);
+        }
+    }
+    uint8_t reasons = stats.reasons;
+    taskEXIT_CRITICAL();
+
+    // Also picks up escalations deferred by a busy I2C bus
+    clock_mode_switch(reasons ? CLOCK_MODE_PERFORMANCE : CLOCK_MODE_MONITOR);
+}
+
+clock_mode_t clock_mode_get(void) {
+    return stats.mode;
+}
+
+uint32_t clock_mode_timer_clock_hz(void) {
+    uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+
+    // APB1 timers run at twice PCLK1 whenever the APB1 prescaler divides
+    if (profiles[stats.mode].clocks.APB1CLKDivider == RCC_APB1_DIV1) {
+        return pclk1;
+    }
+    return 2 * pclk1;
+}
+
+void clock_mode_get_stats(clock_mode_stats_t *out) {
+    uint32_t now = osKernelGetTickCount();
+
+    vTaskSuspendAll();
+    *out = stats;
+    out->ticks_in_mode[stats.mode] += now - mode_entered_tick;
+    xTaskResumeAll();
+}
+
+uint16_t clock_mode_build_report(uint8_t *buffer, uint16_t size) {
+    clock_mode_stats_t snapshot;
+
+    if (size < CLOCK_MODE_REPORT_SIZE) {
+        return 0;
+    }
+
+    clock_mode_get_stats(&snapshot);
+
+    buffer[0] = (uint8_t)snapshot.mode;
+    buffer[1] = snapshot.reasons;
+    ttc_put_u32(&buffer[2], snapshot.switches[CLOCK_MODE_MONITOR]);
+    ttc_put_u32(&buffer[6], snapshot.switches[CLOCK_MODE_PERFORMANCE]);
+    ttc_put_u32(&buffer[10], snapshot.deferred);
+    ttc_put_u32(&buffer[14], snapshot.ticks_in_mode[CLOCK_MODE_MONITOR]);
+    ttc_put_u32(&buffer[18], snapshot.ticks_in_mode[CLOCK_MODE_PERFORMANCE]);
+    ttc_put_u32(&buffer[22], snapshot.last_switch_us);
+    ttc_put_u32(&buffer[26], snapshot.worst_switch_us);
+
+    return CLOCK_MODE_REPORT_SIZE;
+}
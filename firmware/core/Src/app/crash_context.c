@@ -0,0 +1,123 @@
+#include "crash_context.h"
+#include "crc32.h"
+#include "blackbox.h"
+#include "memory_map.h"
+#include <string.h>
+
+static crash_context_t retained_context RETAINED_RAM;
+
+// What the previous run left behind, frozen at boot for the first telemetry frame
+static crash_context_t boot_report;
+
+static uint32_t crash_context_crc(const crash_context_t *context) {
+    return crc32_compute(context, offsetof(crash_context_t, crc));
+}
+
+static void crash_context_seal(void) {
+    retained_context.crc = crash_context_crc(&retained_context);
+
+    // D3 SRAM is mapped non-cacheable (mpu_map.c); the clean only matters
+    // if that mapping is ever changed, since a reset does not flush the D-cache
+    SCB_CleanDCache_by_Addr((uint32_t *)&retained_context, sizeof(retained_context));
+}
+
+void crash_context_init(void) {
+    // Must run before anything clears RCC_RSR or writes to the context
+    uint32_t reset_flags = RCC->RSR;
+    uint8_t valid = (retained_context.magic == CRASH_CONTEXT_MAGIC) &&
+                    (retained_context.crc == crash_context_crc(&retained_context));
+
+    if (!valid) {
+        // Power-on or corrupted retention - start a fresh history
+        memset(&retained_context, 0, sizeof(retained_context));
+        retained_context.magic = CRASH_CONTEXT_MAGIC;
+    }
+
+    boot_report = retained_context;
+    boot_report.boot_count++;
+    boot_report.reset_flags = reset_flags;
+    boot_report.valid_on_boot = valid;
+
+    // Arm the context for this run
+    retained_context.boot_count = boot_report.boot_count;
+    retained_context.reset_flags = reset_flags;
+    retained_context.reason = CRASH_REASON_NONE;
+    retained_context.reason_data = 0;
+    retained_context.last_system_state = SYS_STATE_BOOT;
+    retained_context.last_checkpoint_time = 0;
+    memset(&retained_context.fault_frame, 0, sizeof(retained_context.fault_frame));
+    crash_context_seal();
+
+    // Clear the flags so the next boot sees only its own reset cause
+    __HAL_RCC_CLEAR_RESET_FLAGS();
+}
+
+const crash_context_t* crash_context_get_boot_report(void) {
+    return &boot_report;
+}
+
+void crash_context_note_fault(const ml_result_t *fault) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    retained_context.last_fault_class = fault->predicted_class;
+    retained_context.last_fault_time = fault->timestamp;
+    retained_context.last_system_state = (uint8_t)current_system_state;
+    crash_context_seal();
+
+    __set_PRIMASK(primask);
+}
+
+void crash_context_note_reset(crash_reason_t reason, uint32_t reason_data) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    retained_context.reason = (uint8_t)reason;
+    retained_context.reason_data = reason_data;
+    retained_context.last_system_state = (uint8_t)current_system_state;
+    crash_context_seal();
+
+    __set_PRIMASK(primask);
+}
+
+void crash_context_checkpoint(void) {
+    // Periodic snapshot so an unannounced reset still shows where we were
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    retained_context.last_system_state = (uint8_t)current_system_state;
+    retained_context.last_checkpoint_time = HAL_GetTick();
+    crash_context_seal();
+
+    __set_PRIMASK(primask);
+}
+
+void crash_context_capture_hardfault(uint32_t *stack_frame) {
+    crash_fault_frame_t *frame = &retained_context.fault_frame;
+
+    frame->r0 = stack_frame[0];
+    frame->r1 = stack_frame[1];
+    frame->r2 = stack_frame[2];
+    frame->r3 = stack_frame[3];
+    frame->r12 = stack_frame[4];
+    frame->lr = stack_frame[5];
+    frame->pc = stack_frame[6];
+    frame->xpsr = stack_frame[7];
+    frame->cfsr = SCB->CFSR;
+    frame->hfsr = SCB->HFSR;
+    frame->mmfar = SCB->MMFAR;
+    frame->bfar = SCB->BFAR;
+
+    retained_context.reason = CRASH_REASON_HARDFAULT;
+    retained_context.reason_data = frame->pc;
+    retained_context.last_system_state = (uint8_t)current_system_state;
+    crash_context_seal();
+
+    // The history up to the fault, unless a capture is already held
+    blackbox_retain_on_crash();
+
+    // Context is safe in RAM_D3 - reboot instead of hanging until the
+    // external watchdog notices
+    __DSB();
+    NVIC_SystemReset();
+}
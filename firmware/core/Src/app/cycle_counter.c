@@ -0,0 +1,9 @@
+#include "cycle_counter.h"
+
+void cycle_counter_init(void) {
+    // Enable trace, unlock the DWT (required on Cortex-M7) and start counting
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
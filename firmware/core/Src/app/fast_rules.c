@@ -0,0 +1,336 @@
+#include "fast_rules.h"
+#include "low_power.h"
+#include "clock_mode.h"
+#include "cycle_counter.h"
+#include "memory_map.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+extern osMessageQueueId_t faultQueueHandle;
+
+// What each rule raises
+static const struct {
+    uint8_t fault_class;
+    clock_reason_t clock_reason;
+} rules[FAST_RULE_COUNT] = {
+    [FAST_RULE_HEARTBEAT_LOST] = {1, CLOCK_REASON_HEARTBEAT},
+    [FAST_RULE_UART_TIMEOUT] = {3, CLOCK_REASON_ML_ANOMALY},
+    [FAST_RULE_CORRUPTION] = {4, CLOCK_REASON_ML_ANOMALY},
+};
+
+static fast_rules_stats_t stats;
+
+// Per fault class: when its rule last fired, in cycles for the latency
+// and in ticks for the hold
+static uint32_t fire_cycles[FAST_RULES_CLASSES];
+static uint32_t fire_tick[FAST_RULES_CLASSES];
+static uint8_t fired;                   // Bit per class index
+
+#define BURST_MAX ((FAST_RULE_CORRUPTION_ERRORS > FAST_RULE_UART_TIMEOUTS) ? \
+                   FAST_RULE_CORRUPTION_ERRORS : FAST_RULE_UART_TIMEOUTS)
+
+// Ticks of the last few events of one kind, for the rules that need
+// several within a window
+typedef struct {
+    uint32_t ticks[BURST_MAX];
+    uint8_t next;
+    uint8_t count;
+} burst_t;
+
+static burst_t corruption_burst;
+static burst_t timeout_burst;
+
+static uint8_t heartbeat_armed = 0;
+
+// Same clock and prescaler as LPTIM1, whose rate low_power calibrated
+static void heartbeat_deadline_init(void) {
+    low_power_stats_t power;
+    low_power_get_stats(&power);
+
+    uint32_t counts = (power.lptim_hz * FAST_RULE_HEARTBEAT_TIMEOUT_MS) / 1000U;
+    if (counts == 0 || counts > 0xFFFF) {
+        return;
+    }
+
+    if (power.lse_running) {
+        __HAL_RCC_LPTIM2_CONFIG(RCC_LPTIM2CLKSOURCE_LSE);
+    } else {
+        __HAL_RCC_LPTIM2_CONFIG(RCC_LPTIM2CLKSOURCE_LSI);
+    }
+    __HAL_RCC_LPTIM2_CLK_ENABLE();
+    __HAL_RCC_LPTIM2_CLKAM_ENABLE();
+
+    // Free-running; every heartbeat edge resets the counter, so the
+    // compare match only comes FAST_RULE_HEARTBEAT_TIMEOUT_MS after the
+    // last one. IER may only be written while the timer is disabled.
+    LPTIM2->CR = 0;
+    LPTIM2->CFGR = (uint32_t)LOW_POWER_LPTIM_PRESCALER_LOG2 << LPTIM_CFGR_PRESC_Pos;
+    LPTIM2->IER = LPTIM_IER_CMPMIE;
+    LPTIM2->CR = LPTIM_CR_ENABLE;
+
+    LPTIM2->ICR = LPTIM_ICR_ARROKCF;
+    LPTIM2->ARR = 0xFFFF;
+    while (!(LPTIM2->ISR & LPTIM_ISR_ARROK)) {}
+    LPTIM2->ICR = LPTIM_ICR_CMPOKCF;
+    LPTIM2->CMP = counts;
+    while (!(LPTIM2->ISR & LPTIM_ISR_CMPOK)) {}
+    LPTIM2->ICR = LPTIM_ICR_ARROKCF | LPTIM_ICR_CMPOKCF | LPTIM_ICR_CMPMCF;
+
+    LPTIM2->CR |= LPTIM_CR_CNTSTRT;
+
+    // LPTIM2 (line 48) may wake the core from STOP, as LPTIM1 does
+    EXTI_D1->IMR2 |= EXTI_IMR2_IM48;
+
+    HAL_NVIC_SetPriority(LPTIM2_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(LPTIM2_IRQn);
+    heartbeat_armed = 1;
+}
+
+// Runs in boot_task after low_power_init: the heartbeat deadline needs
+// the low-speed clock. The polled checks cover the time before.
+void fast_rules_init(void) {
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    taskENTER_CRITICAL();
+    memset(&stats, 0, sizeof(stats));
+    fired = 0;
+    memset(&corruption_burst, 0, sizeof(corruption_burst));
+    memset(&timeout_burst, 0, sizeof(timeout_burst));
+    taskEXIT_CRITICAL();
+
+    heartbeat_deadline_init();
+
+    // The OBC heartbeat interrupts on each pulse; heartbeat_monitor_task
+    // still reads the level
+    GPIO_InitStruct.Pin = HEARTBEAT_IN_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    HAL_GPIO_Init(HEARTBEAT_IN_PORT, &GPIO_InitStruct);
+
+    HAL_NVIC_SetPriority(EXTI15_10_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+}
+
+// Raises the rule's fault; from an interrupt at or below the syscall
+// priority, or from a task
+static ITCM_FUNC void rule_fire(fast_rule_t rule, uint32_t event_cycles) {
+    uint8_t index = (uint8_t)(rules[rule].fault_class - 1);
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    uint32_t now = xTaskGetTickCountFromISR();
+    fire_cycles[index] = event_cycles;
+    fire_tick[index] = now;
+    fired |= (uint8_t)(1U << index);
+    stats.fault_class[index].rule_fires++;
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    ml_result_t fault = {
+        .predicted_class = rules[rule].fault_class,
+        .source = FAULT_SOURCE_RULE,
+        .confidence = 1.0f,
+        .timestamp = now
+    };
+    osMessageQueuePut(faultQueueHandle, &fault, 0, 0);
+}
+
+ITCM_FUNC void fast_rules_heartbeat_edge_from_isr(void) {
+    // Restart the deadline; the reset takes a few LPTIM clocks, well
+    // inside a heartbeat period
+    if (heartbeat_armed && !(LPTIM2->CR & LPTIM_CR_COUNTRST)) {
+        LPTIM2->CR |= LPTIM_CR_COUNTRST;
+    }
+}
+
+ITCM_FUNC void fast_rules_lptim_irq(void) {
+    uint32_t now = cycle_counter_now();
+
+    LPTIM2->ICR = LPTIM_ICR_CMPMCF;
+
+    // Re-armed, so a heartbeat that stays lost fires again every timeout
+    // as the polled check did
+    if (!(LPTIM2->CR & LPTIM_CR_COUNTRST)) {
+        LPTIM2->CR |= LPTIM_CR_COUNTRST;
+    }
+    rule_fire(FAST_RULE_HEARTBEAT_LOST, now);
+}
+
+// One more event; returns 1 when it makes needed of them within
+// window_ms. Inside a critical section.
+static ITCM_FUNC uint8_t burst_event(burst_t *b, uint8_t needed, uint32_t window_ms, uint32_t now) {
+    b->ticks[b->next] = now;
+    b->next = (uint8_t)((b->next + 1) % needed);
+    if (b->count < needed) {
+        b->count++;
+    }
+
+    // next is now the oldest of the last few
+    if (b->count == needed && (now - b->ticks[b->next]) <= pdMS_TO_TICKS(window_ms)) {
+        b->count = 0;               // The next burst starts from scratch
+        return 1;
+    }
+    return 0;
+}
+
+// One more corrupted frame or byte; returns 1 when it completes a burst
+static ITCM_FUNC uint8_t corruption_event(void) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    stats.corruption_errors++;
+    uint8_t burst = burst_event(&corruption_burst, FAST_RULE_CORRUPTION_ERRORS,
+                                FAST_RULE_CORRUPTION_WINDOW_MS, xTaskGetTickCountFromISR());
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    return burst;
+}
+
+// One more receiver timeout; returns 1 when the link has dropped often
+// enough to be a fault
+static ITCM_FUNC uint8_t timeout_event(void) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    stats.uart_timeouts++;
+    uint8_t burst = burst_event(&timeout_burst, FAST_RULE_UART_TIMEOUTS,
+                                FAST_RULE_UART_TIMEOUT_WINDOW_MS, xTaskGetTickCountFromISR());
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    return burst;
+}
+
+// From HAL_UART_ErrorCallback: the receiver timeout, and framing, noise
+// and parity errors. An overrun is this side's loss, not the link's.
+ITCM_FUNC void fast_rules_uart_error_from_isr(uint32_t error_code) {
+    uint32_t now = cycle_counter_now();
+
+    if ((error_code & HAL_UART_ERROR_RTO) && timeout_event()) {
+        rule_fire(FAST_RULE_UART_TIMEOUT, now);
+    }
+    if ((error_code & (HAL_UART_ERROR_FE | HAL_UART_ERROR_NE | HAL_UART_ERROR_PE)) &&
+        corruption_event()) {
+        rule_fire(FAST_RULE_CORRUPTION, now);
+    }
+}
+
+// An uplink frame failed its CRC; called by the uplink parser
+void fast_rules_crc_error(void) {
+    uint32_t now = cycle_counter_now();
+
+    if (corruption_event()) {
+        rule_fire(FAST_RULE_CORRUPTION, now);
+    }
+}
+
+// Whether a rule raised this class within FAST_RULES_HOLD_MS
+uint8_t fast_rules_claimed(uint8_t fault_class) {
+    uint8_t claimed = 0;
+
+    if (fault_class == 0 || fault_class > FAST_RULES_CLASSES) {
+        return 0;
+    }
+
+    uint8_t index = (uint8_t)(fault_class - 1);
+    taskENTER_CRITICAL();
+    if ((fired & (1U << index)) &&
+        (osKernelGetTickCount() - fire_tick[index]) < pdMS_TO_TICKS(FAST_RULES_HOLD_MS)) {
+        claimed = 1;
+    }
+    taskEXIT_CRITICAL();
+
+    return claimed;
+}
+
+static void note_latency(uint32_t *last, uint32_t *worst, uint32_t us) {
+    *last = us;
+    if (us > *worst) {
+        *worst = us;
+    }
+}
+
+// A fault from ml_inference_task, sample taken at sample_cycles. Returns
+// 1 if a rule already raised it, and the caller drops it.
+uint8_t fast_rules_note_network(const ml_result_t *result, uint32_t sample_cycles) {
+    uint32_t us = CYCLES_TO_US(cycle_counter_now() - sample_cycles);
+
+    if (result->predicted_class == 0 || result->predicted_class > FAST_RULES_CLASSES) {
+        return 0;
+    }
+
+    uint8_t claimed = fast_rules_claimed(result->predicted_class);
+    fast_rules_class_stats_t *entry = &stats.fault_class[result->predicted_class - 1];
+    taskENTER_CRITICAL();
+    entry->network_detections++;
+    note_latency(&entry->network_last_us, &entry->network_worst_us, us);
+    if (claimed) {
+        stats.network_dropped++;
+    }
+    taskEXIT_CRITICAL();
+
+    return claimed;
+}
+
+// Called by handle_detected_fault first thing. Rule faults get the clock
+// boost here, since the interrupt could not switch clocks.
+void fast_rules_note_handled(const ml_result_t *fault) {
+    uint32_t now = cycle_counter_now();
+
+    if (fault->source != FAULT_SOURCE_RULE ||
+        fault->predicted_class == 0 || fault->predicted_class > FAST_RULES_CLASSES) {
+        return;
+    }
+
+    uint8_t index = (uint8_t)(fault->predicted_class - 1);
+    fast_rules_class_stats_t *entry = &stats.fault_class[index];
+    taskENTER_CRITICAL();
+    note_latency(&entry->rule_last_us, &entry->rule_worst_us,
+                 CYCLES_TO_US(now - fire_cycles[index]));
+    taskEXIT_CRITICAL();
+
+    for (int rule = 0; rule < FAST_RULE_COUNT; rule++) {
+        if (rules[rule].fault_class == fault->predicted_class) {
+            clock_mode_request(rules[rule].clock_reason);
+        }
+    }
+}
+
+void fast_rules_get_stats(fast_rules_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t fast_rules_build_report(uint8_t *buffer, uint16_t size) {
+    fast_rules_stats_t snapshot;
+    uint8_t armed = FAST_RULE_BIT(FAST_RULE_CORRUPTION);
+
+    if (size < FAST_RULES_REPORT_SIZE) {
+        return 0;
+    }
+
+    fast_rules_get_stats(&snapshot);
+
+    if (heartbeat_armed) {
+        armed |= FAST_RULE_BIT(FAST_RULE_HEARTBEAT_LOST);
+    }
+    if (USART1->CR2 & USART_CR2_RTOEN) {
+        armed |= FAST_RULE_BIT(FAST_RULE_UART_TIMEOUT);
+    }
+
+    buffer[0] = armed;
+    buffer[1] = 0;
+    buffer[2] = 0;
+    buffer[3] = 0;
+    ttc_put_u32(&buffer[4], snapshot.network_dropped);
+    ttc_put_u32(&buffer[8], snapshot.corruption_errors);
+    ttc_put_u32(&buffer[12], snapshot.uart_timeouts);
+
+    uint8_t *entry = &buffer[16];
+    for (int i = 0; i < FAST_RULES_CLASSES; i++) {
+        const fast_rules_class_stats_t *c = &snapshot.fault_class[i];
+        ttc_put_u32(&entry[0], c->rule_fires);
+        ttc_put_u32(&entry[4], c->rule_last_us);
+        ttc_put_u32(&entry[8], c->rule_worst_us);
+        ttc_put_u32(&entry[12], c->network_detections);
+        ttc_put_u32(&entry[16], c->network_last_us);
+        ttc_put_u32(&entry[20], c->network_worst_us);
+        entry += 6 * 4;
+    }
+
+    return FAST_RULES_REPORT_SIZE;
+}
@@ -1,16 +1,24 @@
 #include "fault_handler.h"
 #include "fault_detection.h"
 #include "cmsis_os.h"
+#include "task_health.h"
+#include "boot_timeline.h"
 
 extern osMessageQueueId_t faultQueueHandle;
 
 void fault_handler_task(void *argument) {
     ml_result_t fault;
+
+    // Highest priority task, so the first one the scheduler runs
+    boot_timeline_mark(BOOT_STEP_SCHEDULER);
     
     for(;;) {
-        // Wait for fault messages from the queue
-        if (osMessageQueueGet(faultQueueHandle, &fault, NULL, osWaitForever) == osOK) {
+        // Wait for fault messages from the queue, waking up periodically
+        // so an idle handler still proves it is alive
+        if (osMessageQueueGet(faultQueueHandle, &fault, NULL, 1000) == osOK) {
             handle_detected_fault(&fault);
         }
+
+        task_health_checkin(TASK_HEALTH_FAULT_HANDLER);
     }
 }
\ No newline at end of file
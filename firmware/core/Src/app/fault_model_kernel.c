@@ -0,0 +1,127 @@
+#include "fault_model_kernel.h"
+#include "memory_map.h"
+#include <math.h>
+#include <string.h>
+
+// Rows per pass: every input is loaded once for all of them, and their
+// accumulators are independent VFMA chains, so the M7 issues the next
+// multiply-accumulate while the previous ones are still in flight
+#define DENSE_ROWS 4
+
+// Dense layer with ReLU fused into the store. Always inlined with constant
+// sizes, so GCC unrolls it completely for each layer. Every row still sums
+// in input order starting from its bias, the same order as the runtime.
+static inline __attribute__((always_inline))
+void dense(const float *weights, const float *bias, const float *in, float *out,
+           int outputs, int inputs, int relu) {
+    int blocked = outputs - outputs % DENSE_ROWS;
+
+    for (int o = 0; o < blocked; o += DENSE_ROWS) {
+        const float *w = &weights[o * inputs];
+        float acc0 = bias[o];
+        float acc1 = bias[o + 1];
+        float acc2 = bias[o + 2];
+        float acc3 = bias[o + 3];
+
+#pragma GCC unroll 16
+        for (int i = 0; i < inputs; i++) {
+            float x = in[i];
+            acc0 += w[i] * x;
+            acc1 += w[inputs + i] * x;
+            acc2 += w[2 * inputs + i] * x;
+            acc3 += w[3 * inputs + i] * x;
+        }
+
+        if (relu) {
+            acc0 = (acc0 > 0.0f) ? acc0 : 0.0f;
+            acc1 = (acc1 > 0.0f) ? acc1 : 0.0f;
+            acc2 = (acc2 > 0.0f) ? acc2 : 0.0f;
+            acc3 = (acc3 > 0.0f) ? acc3 : 0.0f;
+        }
+        out[o] = acc0;
+        out[o + 1] = acc1;
+        out[o + 2] = acc2;
+        out[o + 3] = acc3;
+    }
+
+    // Rows left over when the layer is not a multiple of DENSE_ROWS
+    for (int o = blocked; o < outputs; o++) {
+        const float *w = &weights[o * inputs];
+        float acc = bias[o];
+
+#pragma GCC unroll 16
+        for (int i = 0; i < inputs; i++) {
+            acc += w[i] * in[i];
+        }
+
+        out[o] = (relu && acc < 0.0f) ? 0.0f : acc;
+    }
+}
+
+ITCM_FUNC void fault_model_softmax(float *values) {
+    const int count = FAULT_MODEL_OUTPUTS;
+    float peak = values[0];
+    float sum = 0.0f;
+
+    for (int i = 1; i < count; i++) {
+        if (values[i] > peak) {
+            peak = values[i];
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        values[i] = expf(values[i] - peak);
+        sum += values[i];
+    }
+
+    for (int i = 0; i < count; i++) {
+        values[i] /= sum;
+    }
+}
+
+// Whole network up to the gemm_2 logits in one call: no layer dispatch,
+// no tensor descriptors and the activations stay in registers or on the
+// stack
+ITCM_FUNC void fault_model_kernel_logits(const float *input, float *logits) {
+    float hidden1[FAULT_MODEL_HIDDEN1];
+    float hidden2[FAULT_MODEL_HIDDEN2];
+
+    dense(fault_model_hidden1_weights, fault_model_hidden1_bias, input, hidden1,
+          FAULT_MODEL_HIDDEN1, FAULT_MODEL_INPUTS, 1);
+    dense(fault_model_hidden2_weights, fault_model_hidden2_bias, hidden1, hidden2,
+          FAULT_MODEL_HIDDEN2, FAULT_MODEL_HIDDEN1, 1);
+    dense(fault_model_output_weights, fault_model_output_bias, hidden2, logits,
+          FAULT_MODEL_OUTPUTS, FAULT_MODEL_HIDDEN2, 0);
+}
+
+ITCM_FUNC void fault_model_kernel_run(const float *input, float *output) {
+    fault_model_kernel_logits(input, output);
+    fault_model_softmax(output);
+}
+
+// Penultimate activations, what gemm_2 sees. For on-board adaptation of
+// the output layer, so off the inference path and out of ITCM.
+void fault_model_kernel_features(const float *input, float *hidden2) {
+    float hidden1[FAULT_MODEL_HIDDEN1];
+
+    dense(fault_model_hidden1_weights, fault_model_hidden1_bias, input, hidden1,
+          FAULT_MODEL_HIDDEN1, FAULT_MODEL_INPUTS, 1);
+    dense(fault_model_hidden2_weights, fault_model_hidden2_bias, hidden1, hidden2,
+          FAULT_MODEL_HIDDEN2, FAULT_MODEL_HIDDEN1, 1);
+}
+
+// Weights in the runtime's blob layout, e.g. a model_update slot
+void fault_model_kernel_load(const uint8_t *weights) {
+    memcpy(fault_model_hidden1_weights, &weights[FAULT_MODEL_HIDDEN1_WEIGHTS_AT],
+           sizeof(fault_model_hidden1_weights));
+    memcpy(fault_model_hidden1_bias, &weights[FAULT_MODEL_HIDDEN1_BIAS_AT],
+           sizeof(fault_model_hidden1_bias));
+    memcpy(fault_model_hidden2_weights, &weights[FAULT_MODEL_HIDDEN2_WEIGHTS_AT],
+           sizeof(fault_model_hidden2_weights));
+    memcpy(fault_model_hidden2_bias, &weights[FAULT_MODEL_HIDDEN2_BIAS_AT],
+           sizeof(fault_model_hidden2_bias));
+    memcpy(fault_model_output_weights, &weights[FAULT_MODEL_OUTPUT_WEIGHTS_AT],
+           sizeof(fault_model_output_weights));
+    memcpy(fault_model_output_bias, &weights[FAULT_MODEL_OUTPUT_BIAS_AT],
+           sizeof(fault_model_output_bias));
+}
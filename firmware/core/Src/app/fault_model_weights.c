@@ -0,0 +1,59 @@
+// Generated by tools/fault_model_kernel.py from network_data_params.c -
+// do not edit, rerun the tool when the network is regenerated
+#include "fault_model_kernel.h"
+#include "memory_map.h"
+
+DTCM_DATA float fault_model_hidden1_weights[128] = {
+    -2.135560811e-01f, 4.915420413e-01f, 4.131628275e-01f, 2.117550820e-01f, 2.748484313e-01f, 2.719965577e-01f, -2.651275992e-01f, -9.027097225e-01f,
+    -3.432808816e-01f, -4.262189567e-01f, 1.537698209e-01f, -6.652949452e-01f, -1.905254871e-01f, 7.000412941e-01f, -7.204104662e-01f, -8.767624497e-01f,
+    -5.113888979e-01f, 2.667286098e-01f, 4.341905713e-01f, 1.769073904e-01f, 1.215106621e-01f, -8.942314386e-01f, -6.182198226e-02f, 1.003051400e+00f,
+    -2.971061468e-01f, 1.183677837e-01f, -1.067475230e-01f, 3.481210768e-01f, 2.924862206e-01f, 5.099170282e-02f, 9.377234578e-01f, -8.362631202e-01f,
+    8.933133632e-02f, 3.972693905e-02f, -1.741966605e-01f, 3.953017294e-01f, -5.945686623e-02f, 7.826545835e-01f, -7.747885585e-01f, -7.053332031e-02f,
+    -2.381882966e-01f, -1.017158329e-01f, -2.431001812e-01f, 7.934582978e-02f, -5.815824270e-01f, 5.909267664e-01f, -4.872244596e-01f, -7.980956435e-01f,
+    1.229679864e-02f, 3.179582655e-01f, -4.077238739e-01f, 3.005305305e-02f, -5.989882946e-01f, -3.864550292e-01f, -3.641062379e-01f, 4.984990656e-01f,
+    1.826169491e-01f, 8.191432059e-02f, -2.650538683e-01f, -2.286503613e-01f, 7.157573104e-02f, -4.570477903e-01f, -1.877681166e-01f, 9.338267148e-02f,
+    3.495185375e-01f, -1.267016381e-01f, -2.410526015e-02f, -5.660166740e-01f, 3.846542239e-01f, 2.856641412e-01f, -7.339032292e-01f, 2.212540656e-01f,
+    -3.621963561e-01f, 2.384851724e-01f, 4.727795348e-02f, -7.697249204e-02f, -8.865222335e-01f, -3.502865732e-01f, -2.994733155e-01f, 5.423735976e-01f,
+    -5.260807872e-01f, -4.043292999e-02f, 6.080229282e-01f, -1.444464624e-01f, -1.441785395e-01f, 2.307849377e-02f, 3.601803184e-01f, -2.955106199e-01f,
+    -6.670437008e-02f, -3.866214771e-03f, -4.746372402e-01f, 2.371256053e-01f, 9.687299132e-01f, -2.491313368e-01f, -3.665383458e-01f, -3.811806440e-01f,
+    3.764835000e-01f, -2.181750983e-01f, 5.239920691e-02f, -1.064498946e-01f, -7.155386806e-01f, 3.264418840e-01f, 7.585629821e-01f, -5.842646956e-01f,
+    3.188733757e-01f, -9.355451167e-02f, -6.596715003e-02f, 5.171139240e-01f, 6.488803029e-02f, 4.596054554e-01f, -7.753648758e-01f, -4.746220708e-01f,
+    3.598108888e-01f, -1.275051981e-01f, 8.982679993e-02f, -5.181774497e-01f, 6.897312999e-01f, 6.905782819e-01f, -3.060637116e-01f, -3.493393362e-01f,
+    -3.522506058e-01f, 4.248342216e-01f, 4.955345988e-01f, 1.088827252e-01f, 3.718201770e-03f, 2.803502083e-01f, -2.992941141e-01f, 6.512295008e-01f,
+};
+
+DTCM_DATA float fault_model_hidden1_bias[16] = {
+    4.458136857e-01f, 4.744638503e-01f, -1.583977491e-01f, 5.332125425e-01f,
+    4.157543182e-01f, 4.727315605e-01f, 2.542688251e-01f, 7.663481403e-03f,
+    4.042089283e-01f, 2.172868699e-01f, -1.967577487e-01f, 4.728614092e-01f,
+    3.593696654e-01f, 3.869776726e-01f, 4.344402850e-01f, -3.118673265e-01f,
+};
+
+DTCM_DATA float fault_model_hidden2_weights[128] = {
+    5.218112841e-02f, 2.273382843e-01f, 1.021066546e+00f, -2.403853983e-01f, 1.376607716e-01f, 1.502576619e-01f, 8.978822827e-01f, 6.880303621e-01f, -1.898108870e-01f, 7.067414522e-01f, 2.031755000e-01f, 2.624355257e-01f, 3.829177916e-01f, -6.372248381e-02f, -5.819911957e-01f, 1.748923771e-02f,
+    3.718351424e-01f, 6.445758343e-01f, -1.050666720e-01f, 6.418386102e-02f, 2.874089181e-01f, 9.246792197e-01f, 6.185742095e-02f, -2.738976181e-01f, 5.626021624e-01f, 1.981207728e-02f, -5.504358411e-01f, 4.606997073e-01f, 1.977489442e-01f, 5.664450526e-01f, 6.573712826e-01f, -6.771149635e-01f,
+    -2.535139620e-01f, -3.122875094e-01f, -3.037987649e-01f, 8.245701790e-01f, -5.194594860e-01f, 2.131849974e-01f, 5.578767657e-01f, -3.039693534e-01f, 1.093239933e-01f, -7.516609970e-03f, 3.578638732e-01f, 9.071924537e-02f, 8.452729583e-01f, -5.112581849e-01f, -6.976585090e-02f, -3.361954689e-01f,
+    8.759182096e-01f, 2.887975574e-01f, -1.280665994e-01f, 3.085749149e-01f, 4.796609879e-01f, 1.935730278e-01f, 1.413214952e-01f, 6.393263936e-01f, 7.296407819e-01f, -9.981649369e-02f, -4.937023856e-03f, 6.383072138e-01f, -8.391159177e-01f, 7.224581242e-01f, 7.308511734e-01f, 6.474667192e-01f,
+    4.706350863e-01f, 2.997939587e-01f, 1.857809722e-01f, 9.733826518e-01f, 2.226930112e-01f, -1.355885565e-01f, -7.012750506e-01f, -2.927595377e-01f, -5.803400651e-02f, -3.168168291e-02f, 6.066018939e-01f, 7.204256654e-01f, 1.778949499e-01f, -2.813876569e-01f, 9.119020104e-01f, 4.761248827e-01f,
+    5.125451088e-01f, -1.348324716e-01f, 2.163048238e-01f, -9.813077748e-03f, -2.892014980e-01f, -6.991277635e-02f, -6.148207784e-01f, 1.279396713e-01f, -1.176470816e-01f, 1.501338482e-01f, 5.721307993e-01f, 1.122628599e-01f, -1.115887016e-01f, -6.313167512e-03f, -1.115086302e-01f, 3.672903180e-01f,
+    -2.300997376e-01f, -1.294981539e-01f, -2.672539353e-01f, 7.944794297e-01f, -5.098612905e-01f, -3.474647701e-01f, 5.206388235e-02f, -2.984072566e-01f, -5.107427239e-01f, 6.517944336e-01f, -2.286430746e-01f, -1.203658246e-02f, 1.130550265e+00f, 1.141136959e-01f, 6.671941280e-02f, -3.786726296e-02f,
+    5.423979759e-01f, 3.607308865e-01f, -6.624333262e-01f, 2.070254236e-01f, 5.963490605e-01f, -1.388536096e-01f, -4.185529947e-01f, 2.992565930e-01f, 1.993659139e-01f, 1.667523175e-03f, -3.493563533e-01f, 6.598105431e-01f, -4.916591197e-02f, 5.914260745e-01f, 2.537107766e-01f, -4.406152368e-01f,
+};
+
+DTCM_DATA float fault_model_hidden2_bias[8] = {
+    -9.477061033e-02f, 2.228984833e-01f, -7.595963776e-03f, 2.394471020e-01f,
+    4.392206073e-01f, -1.378086805e-01f, 5.069041997e-02f, 2.842295766e-01f,
+};
+
+DTCM_DATA float fault_model_output_weights[40] = {
+    -6.070579886e-01f, 1.037057042e+00f, -8.040476441e-01f, 5.609507561e-01f, -3.004395030e-02f, -5.164253116e-01f, -7.928579450e-01f, 1.108329415e+00f,
+    2.749317884e-01f, 3.378840983e-01f, 2.496507466e-01f, -3.182248175e-01f, -9.178866744e-01f, 1.933759451e-01f, 3.576086760e-01f, -2.823611498e-01f,
+    1.155285761e-01f, -8.369441032e-01f, -4.201003611e-01f, 4.276190996e-01f, 1.320730746e-01f, 7.780537009e-01f, -5.109187961e-01f, -8.887488842e-01f,
+    7.935929894e-01f, -9.724605680e-01f, -1.034702063e+00f, 4.216261208e-02f, -8.524098992e-01f, 3.383850679e-02f, -1.190328598e-01f, 6.633231044e-02f,
+    -1.105164886e+00f, -1.678350419e-01f, 5.757878423e-01f, -5.856007338e-01f, 2.812859714e-01f, -2.504678965e-01f, 8.392516971e-01f, -5.764174461e-02f,
+};
+
+DTCM_DATA float fault_model_output_bias[5] = {
+    1.664448529e-01f, -2.438436896e-01f, -2.217639238e-01f, 4.933457077e-02f,
+    -1.070948541e-01f,
+};
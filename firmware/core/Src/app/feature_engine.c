@@ -0,0 +1,232 @@
+#include "feature_engine.h"
+#include "memory_map.h"
+#include <string.h>
+
+// feature_schema.py replays this arithmetic operation for operation;
+// a fused multiply-add would round differently
+#pragma GCC optimize ("fp-contract=off")
+
+typedef struct {
+    float *samples;                 // Ring, shifted by the reference level
+    uint8_t *min_queue;             // Ring positions, samples ascending
+    uint8_t *max_queue;             // Ring positions, samples descending
+    float level;
+    float last;                     // Latest sample, unshifted
+    float sum;
+    float sum_squares;
+    float sum_index;                // Sum of i * sample, i = 0 the oldest
+    uint8_t window;
+    uint8_t head;                   // Next position to write, the oldest once full
+    uint8_t count;
+    uint8_t crossings;
+    uint8_t min_front;
+    uint8_t min_size;
+    uint8_t max_front;
+    uint8_t max_size;
+} feature_window_t;
+
+static const struct {
+    uint8_t window;
+    float level;
+} schema[FEATURE_CHANNEL_COUNT] = {
+#define FEATURE_CHANNEL_ENTRY(name, window, level, resolution) {window, level},
+    FEATURE_SCHEMA_CHANNELS(FEATURE_CHANNEL_ENTRY)
+#undef FEATURE_CHANNEL_ENTRY
+};
+
+static const struct {
+    uint8_t channel;
+    uint8_t stat;
+    float mean;                     // Training scaler
+    float scale;
+} model_inputs[FEATURE_MODEL_INPUTS] = {
+#define FEATURE_INPUT_ENTRY(channel, stat, mean, scale) \
+    {FEATURE_CHANNEL_##channel, FEATURE_STAT_##stat, mean, scale},
+    FEATURE_SCHEMA_MODEL_INPUTS(FEATURE_INPUT_ENTRY)
+#undef FEATURE_INPUT_ENTRY
+};
+
+static feature_window_t windows[FEATURE_CHANNEL_COUNT];
+
+// Fixed arena, sliced per channel at init
+static float arena_samples[FEATURE_ARENA_SAMPLES] DTCM_BSS;
+static uint8_t arena_queues[2 * FEATURE_ARENA_SAMPLES] DTCM_BSS;
+
+void feature_engine_init(void) {
+    uint16_t offset = 0;
+
+    memset(windows, 0, sizeof(windows));
+    memset(arena_samples, 0, sizeof(arena_samples));
+
+    for (int c = 0; c < FEATURE_CHANNEL_COUNT; c++) {
+        feature_window_t *w = &windows[c];
+        w->window = schema[c].window;
+        w->level = schema[c].level;
+        w->samples = &arena_samples[offset];
+        w->min_queue = &arena_queues[2 * offset];
+        w->max_queue = &arena_queues[2 * offset + w->window];
+        offset = (uint16_t)(offset + w->window);
+    }
+}
+
+static inline uint8_t crosses(float a, float b) {
+    return (a >= 0.0f) != (b >= 0.0f);
+}
+
+static inline uint8_t ring_at(const feature_window_t *w, uint8_t front, uint8_t offset) {
+    return (uint8_t)((front + offset) % w->window);
+}
+
+static ITCM_FUNC void window_push(feature_window_t *w, float value) {
+    const uint8_t n = w->window;
+    float x = value - w->level;
+
+    w->last = value;
+
+    if (w->count == n) {
+        // Drop the oldest, at head, and the neighbour pair it was part of
+        float old = w->samples[w->head];
+        if (crosses(old, w->samples[ring_at(w, w->head, 1)])) {
+            w->crossings--;
+        }
+        w->sum_index = (w->sum_index - (w->sum - old)) + (float)(n - 1) * x;
+        w->sum = (w->sum - old) + x;
+        w->sum_squares = (w->sum_squares - old * old) + x * x;
+
+        if (w->min_size > 0 && w->min_queue[w->min_front] == w->head) {
+            w->min_front = ring_at(w, w->min_front, 1);
+            w->min_size--;
+        }
+        if (w->max_size > 0 && w->max_queue[w->max_front] == w->head) {
+            w->max_front = ring_at(w, w->max_front, 1);
+            w->max_size--;
+        }
+    } else {
+        w->sum_index = w->sum_index + (float)w->count * x;
+        w->sum = w->sum + x;
+        w->sum_squares = w->sum_squares + x * x;
+        w->count++;
+    }
+
+    if (w->count > 1 && crosses(w->samples[ring_at(w, w->head, (uint8_t)(n - 1))], x)) {
+        w->crossings++;
+    }
+
+    w->samples[w->head] = x;
+
+    // Monotonic queues: the front is the window's min (max), everything
+    // behind it a candidate for when the front leaves
+    while (w->min_size > 0 &&
+           w->samples[w->min_queue[ring_at(w, w->min_front, (uint8_t)(w->min_size - 1))]] >= x) {
+        w->min_size--;
+    }
+    w->min_queue[ring_at(w, w->min_front, w->min_size)] = w->head;
+    w->min_size++;
+
+    while (w->max_size > 0 &&
+           w->samples[w->max_queue[ring_at(w, w->max_front, (uint8_t)(w->max_size - 1))]] <= x) {
+        w->max_size--;
+    }
+    w->max_queue[ring_at(w, w->max_front, w->max_size)] = w->head;
+    w->max_size++;
+
+    w->head = ring_at(w, w->head, 1);
+
+    // Rounding in the running sums is dropped once per window, O(1)
+    // amortised
+    if (w->head == 0) {
+        w->sum = 0.0f;
+        w->sum_squares = 0.0f;
+        w->sum_index = 0.0f;
+        for (uint8_t i = 0; i < n; i++) {
+            float v = w->samples[i];
+            w->sum = w->sum + v;
+            w->sum_squares = w->sum_squares + v * v;
+            w->sum_index = w->sum_index + (float)i * v;
+        }
+    }
+}
+
+// One sample per channel, in feature_channel_t order; called once per
+// inference period
+ITCM_FUNC void feature_engine_push(const float *sample) {
+    for (int c = 0; c < FEATURE_CHANNEL_COUNT; c++) {
+        window_push(&windows[c], sample[c]);
+    }
+}
+
+float feature_engine_stat(feature_channel_t channel, feature_stat_t stat) {
+    const feature_window_t *w = &windows[channel];
+    const float period = FEATURE_SAMPLE_PERIOD_MS / 1000.0f;
+    const uint8_t n = w->count;
+
+    if (n == 0) {
+        return 0.0f;
+    }
+
+    float newest = w->samples[ring_at(w, w->head, (uint8_t)(w->window - 1))];
+    float oldest = w->samples[ring_at(w, w->head, (uint8_t)(w->window - n))];
+
+    switch (stat) {
+        case FEATURE_STAT_VALUE:
+            return w->last;
+
+        case FEATURE_STAT_MEAN:
+            return w->level + w->sum / (float)n;
+
+        case FEATURE_STAT_VARIANCE: {
+            float mean = w->sum / (float)n;
+            float variance = w->sum_squares / (float)n - mean * mean;
+            return (variance > 0.0f) ? variance : 0.0f;
+        }
+
+        case FEATURE_STAT_SLOPE: {
+            if (n < 2) {
+                return 0.0f;
+            }
+            // Sums over i = 0..n-1 are exact in integers
+            uint32_t index_sum = (uint32_t)n * (n - 1) / 2;
+            uint32_t index_squares = (uint32_t)(n - 1) * n * (2U * n - 1) / 6;
+            uint32_t denominator = (uint32_t)n * index_squares - index_sum * index_sum;
+            float numerator = (float)n * w->sum_index - (float)index_sum * w->sum;
+            return numerator / (float)denominator / period;
+        }
+
+        case FEATURE_STAT_MIN:
+            return w->samples[w->min_queue[w->min_front]] + w->level;
+
+        case FEATURE_STAT_MAX:
+            return w->samples[w->max_queue[w->max_front]] + w->level;
+
+        case FEATURE_STAT_CROSSINGS:
+            return (float)w->crossings;
+
+        case FEATURE_STAT_RATE:
+            if (n < 2) {
+                return 0.0f;
+            }
+            return (newest - oldest) / ((float)(n - 1) * period);
+
+        default:
+            return 0.0f;
+    }
+}
+
+// The network's inputs in schema order; the rest of input up to size is
+// cleared
+void feature_engine_model_input(float *input, uint16_t size) {
+    for (uint16_t i = 0; i < size; i++) {
+        input[i] = (i < FEATURE_MODEL_INPUTS) ?
+            feature_engine_stat((feature_channel_t)model_inputs[i].channel,
+                                (feature_stat_t)model_inputs[i].stat) : 0.0f;
+    }
+}
+
+// The classifier's inputs from feature_engine_model_input's, with the
+// scaler the network was trained with. feature_schema.py's standardise
+// is the same arithmetic.
+ITCM_FUNC void feature_engine_standardise(const float *features, float *input) {
+    for (int i = 0; i < FEATURE_MODEL_INPUTS; i++) {
+        input[i] = (features[i] - model_inputs[i].mean) / model_inputs[i].scale;
+    }
+}
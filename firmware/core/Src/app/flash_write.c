@@ -0,0 +1,85 @@
+#include "flash_write.h"
+#include "watchdog_manager.h"
+#include "task_health.h"
+#include "cycle_counter.h"
+#include "memory_map.h"
+#include "cmsis_os.h"
+#include <string.h>
+
+// FLASH_Erase_Sector for bank 1, then the wait, from ITCM: the loop
+// touches nothing but registers and the stack. Returns the error flags;
+// elapsed is summed per pass, so it holds across counter wraps.
+static ITCM_FUNC uint32_t flash_write_erase_parked(uint32_t sector, uint32_t kick_cycles,
+                                                   uint64_t *elapsed) {
+    uint32_t kicks_left = FLASH_WRITE_ERASE_TIMEOUT_MS / WATCHDOG_KICK_INTERVAL_MS;
+    uint32_t last_kick = cycle_counter_now();
+    uint32_t last = last_kick;
+
+    *elapsed = 0;
+
+#if defined(FLASH_CR_PSIZE)
+    FLASH->CR1 &= ~(FLASH_CR_PSIZE | FLASH_CR_SNB);
+    FLASH->CR1 |= FLASH_CR_SER | FLASH_VOLTAGE_RANGE_3 | (sector << FLASH_CR_SNB_Pos) | FLASH_CR_START;
+#else
+    FLASH->CR1 &= ~FLASH_CR_SNB;
+    FLASH->CR1 |= FLASH_CR_SER | (sector << FLASH_CR_SNB_Pos) | FLASH_CR_START;
+#endif
+
+    while ((FLASH->SR1 & FLASH_SR_QW) != 0) {
+        uint32_t now = cycle_counter_now();
+        *elapsed += now - last;
+        last = now;
+        if (now - last_kick >= kick_cycles) {
+            last_kick = now;
+            if (kicks_left > 0) {
+                watchdog_manager_kick_parked();
+                kicks_left--;
+            }
+        }
+    }
+
+    FLASH->CR1 &= ~(FLASH_CR_SER | FLASH_CR_SNB);
+    return FLASH->SR1 & FLASH_FLAG_ALL_ERRORS_BANK1;
+}
+
+// A sector erase stalls every fetch from flash, up to a few seconds on a
+// 128 KiB sector, so on this single-bank part every task would stall with
+// it and come out past its task_health deadline, the watchdog task with
+// them. Instead the erase runs from ITCM with kernel-priority interrupts,
+// every one the application uses, masked: no task or handler runs, the
+// kernel tick stops, and the TPL5010 is kicked from here at
+// watchdog_manager_task's cadence. The ticks missed are measured with the
+// cycle counter and caught up afterwards, with every task_health deadline
+// moved on by as much: no task ran, so none of them is late. Needs
+// MEMORY_MAP_USE_TCM. Not with the scheduler suspended.
+uint8_t flash_write_erase(uint32_t sector) {
+    uint32_t kick_cycles = (SystemCoreClock / 1000U) * WATCHDOG_KICK_INTERVAL_MS;
+    uint64_t elapsed;
+
+    HAL_FLASH_Unlock();
+    __HAL_FLASH_CLEAR_FLAG_BANK1(FLASH_FLAG_ALL_ERRORS_BANK1 | FLASH_FLAG_EOP_BANK1);
+
+    taskENTER_CRITICAL();
+    uint32_t errors = flash_write_erase_parked(sector, kick_cycles, &elapsed);
+    TickType_t missed = (TickType_t)(elapsed / (SystemCoreClock / configTICK_RATE_HZ));
+    task_health_excuse(missed);
+    taskEXIT_CRITICAL();
+
+    xTaskCatchUpTicks(missed);
+
+    __HAL_FLASH_CLEAR_FLAG_BANK1(FLASH_FLAG_ALL_ERRORS_BANK1 | FLASH_FLAG_EOP_BANK1);
+    HAL_FLASH_Lock();
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *)FLASH_WRITE_SECTOR_ADDRESS(sector), FLASH_SECTOR_SIZE);
+    return errors == 0;
+}
+
+// One flash word at a word-aligned address, read back through the cache
+uint8_t flash_write_word(uint32_t address, const uint8_t *data) {
+    HAL_FLASH_Unlock();
+    HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, address, (uint32_t)data);
+    HAL_FLASH_Lock();
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *)address, FLASH_WRITE_WORD);
+    return status == HAL_OK && memcmp((const void *)address, data, FLASH_WRITE_WORD) == 0;
+}
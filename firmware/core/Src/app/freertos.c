@@ -33,6 +33,10 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "runtime_stats.h"
+#include "memory_map.h"
+#include "boot_timeline.h"
+#include "system_init.h"
 
 /* USER CODE END Includes */
 
@@ -53,60 +57,92 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN Variables */
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+// Ground builds keep a small heap for debugging; no RTOS object uses it
+uint8_t ucHeap[configTOTAL_HEAP_SIZE] DTCM_BSS;
+#endif
 
 /* USER CODE END Variables */
 
-// Task handles (if you need them)
-osThreadId_t heartbeatTaskHandle;
-osThreadId_t mlTaskHandle;
-osThreadId_t ledTaskHandle;
-osThreadId_t faultTaskHandle;
-osThreadId_t resetTaskHandle;
-osThreadId_t ttcTaskHandle;
-osThreadId_t watchdogTaskHandle;
-
-// Task attributes
-osThreadAttr_t heartbeat_monitor_attributes = {
-    .name = "HeartbeatMonitor",
-    .stack_size = 1024,
-    .priority = osPriorityNormal,
+// Declarative task table: entry, name, stack bytes, priority, handle.
+// Every stack and control block below is allocated statically in DTCM.
+#define RTOS_TASKS(X) \
+    X(heartbeat_monitor_task, "HeartbeatMonitor", 1024, osPriorityNormal,   heartbeatTaskHandle) \
+    X(ml_inference_task,      "MLInference",      4096, osPriorityNormal,   mlTaskHandle) \
+    X(led_controller_task,    "LEDController",    1024, osPriorityLow,      ledTaskHandle) \
+    X(fault_handler_task,     "FaultHandler",     1536, osPriorityRealtime, faultTaskHandle) \
+    X(reset_control_task,     "ResetControl",     1024, osPriorityHigh,     resetTaskHandle) \
+    X(ttc_monitor_task,       "TTCMonitor",       2048, osPriorityNormal,   ttcTaskHandle) \
+    X(watchdog_manager_task,  "WatchdogManager",  1024, osPriorityHigh,     watchdogTaskHandle) \
+    X(boot_task,              "Boot",             1024, osPriorityBelowNormal, bootTaskHandle)
+
+#define FAULT_QUEUE_DEPTH 10
+
+// Compile-time budget for all statically allocated RTOS objects in DTCM
+#define RTOS_STATIC_RAM_BUDGET (16 * 1024)
+
+void led_controller_task(void *argument);  // Defined in main.c
+
+typedef struct {
+    osThreadFunc_t entry;
+    osThreadAttr_t attr;
+    osThreadId_t *handle;
+} rtos_task_def_t;
+
+// Task handles
+#define RTOS_TASK_HANDLE(entry, task_name, stack, prio, handle) osThreadId_t handle;
+RTOS_TASKS(RTOS_TASK_HANDLE)
+
+// Task stacks and control blocks
+#define RTOS_TASK_STORAGE(entry, task_name, stack, prio, handle) \
+    static StackType_t rtos_stack_##entry[(stack) / sizeof(StackType_t)] DTCM_BSS __attribute__((aligned(8))); \
+    static StaticTask_t rtos_tcb_##entry DTCM_BSS;
+RTOS_TASKS(RTOS_TASK_STORAGE)
+
+#define RTOS_TASK_DEF(fn, task_name, stack, prio, hdl) \
+    { \
+        .entry = fn, \
+        .attr = { \
+            .name = task_name, \
+            .cb_mem = &rtos_tcb_##fn, \
+            .cb_size = sizeof(StaticTask_t), \
+            .stack_mem = rtos_stack_##fn, \
+            .stack_size = sizeof(rtos_stack_##fn), \
+            .priority = prio, \
+        }, \
+        .handle = &hdl, \
+    },
+
+static const rtos_task_def_t rtos_tasks[] = {
+    RTOS_TASKS(RTOS_TASK_DEF)
 };
 
-osThreadAttr_t ml_inference_attributes = {
-    .name = "MLInference", 
-    .stack_size = 4096,
-    .priority = osPriorityNormal,
-};
+// Fault queue storage and control block
+static uint8_t rtos_fault_queue_storage[FAULT_QUEUE_DEPTH * sizeof(ml_result_t)] DTCM_BSS __attribute__((aligned(4)));
+static StaticQueue_t rtos_fault_queue_cb DTCM_BSS;
 
-osThreadAttr_t led_controller_attributes = {
-    .name = "LEDController",
-    .stack_size = 1024,
-    .priority = osPriorityLow,
+static const osMessageQueueAttr_t fault_queue_attributes = {
+    .name = "FaultQueue",
+    .cb_mem = &rtos_fault_queue_cb,
+    .cb_size = sizeof(StaticQueue_t),
+    .mq_mem = rtos_fault_queue_storage,
+    .mq_size = sizeof(rtos_fault_queue_storage),
 };
 
-osThreadAttr_t fault_handler_attributes = {
-    .name = "FaultHandler",
-    .stack_size = 1536,
-    .priority = osPriorityRealtime,
-};
+// Kernel-owned tasks, replacing the weak defaults in cmsis_os2.c so they
+// sit in DTCM and count against the same budget
+static StackType_t rtos_stack_idle[configMINIMAL_STACK_SIZE] DTCM_BSS __attribute__((aligned(8)));
+static StaticTask_t rtos_tcb_idle DTCM_BSS;
+static StackType_t rtos_stack_timer[configTIMER_TASK_STACK_DEPTH] DTCM_BSS __attribute__((aligned(8)));
+static StaticTask_t rtos_tcb_timer DTCM_BSS;
 
-osThreadAttr_t reset_control_attributes = {
-    .name = "ResetControl",
-    .stack_size = 1024, 
-    .priority = osPriorityHigh,
-};
+#define RTOS_TASK_BYTES(entry, task_name, stack, prio, handle) + (stack) + sizeof(StaticTask_t)
+#define RTOS_STATIC_RAM_BYTES (0 RTOS_TASKS(RTOS_TASK_BYTES) \
+    + sizeof(rtos_fault_queue_storage) + sizeof(StaticQueue_t) \
+    + sizeof(rtos_stack_idle) + sizeof(rtos_stack_timer) + 2 * sizeof(StaticTask_t))
 
-osThreadAttr_t ttc_monitor_attributes = {
-    .name = "TTCMonitor",
-    .stack_size = 2048,
-    .priority = osPriorityNormal,
-};
-
-osThreadAttr_t watchdog_manager_attributes = {
-    .name = "WatchdogManager",
-    .stack_size = 1024,
-    .priority = osPriorityHigh,
-};
+_Static_assert(RTOS_STATIC_RAM_BYTES <= RTOS_STATIC_RAM_BUDGET,
+               "Static RTOS objects exceed their DTCM budget - see tools/ram_budget.py");
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN FunctionPrototypes */
@@ -115,6 +151,37 @@ osThreadAttr_t watchdog_manager_attributes = {
 
 void MX_FREERTOS_Init(void); /* (MISRA C 2004 rule 8.1) */
 
+/* Hook prototypes */
+void configureTimerForRunTimeStats(void);
+unsigned long getRunTimeCounterValue(void);
+
+/* USER CODE BEGIN 1 */
+/* Functions needed when configGENERATE_RUN_TIME_STATS is on */
+void configureTimerForRunTimeStats(void)
+{
+  runtime_stats_timer_init();
+}
+
+unsigned long getRunTimeCounterValue(void)
+{
+  return runtime_stats_counter();
+}
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize)
+{
+  *ppxIdleTaskTCBBuffer = &rtos_tcb_idle;
+  *ppxIdleTaskStackBuffer = rtos_stack_idle;
+  *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize)
+{
+  *ppxTimerTaskTCBBuffer = &rtos_tcb_timer;
+  *ppxTimerTaskStackBuffer = rtos_stack_timer;
+  *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+/* USER CODE END 1 */
+
 /**
   * @brief  FreeRTOS initialization
   * @param  None
@@ -123,17 +190,24 @@ void MX_FREERTOS_Init(void); /* (MISRA C 2004 rule 8.1) */
 void MX_FREERTOS_Init(void) {
   /* USER CODE BEGIN Init */
   
+  // Publishes the boot steps main() finished before the kernel existed
+  boot_timeline_start();
+  ml_integration_init();
+
   // Create message queue for fault handling
-  faultQueueHandle = osMessageQueueNew(10, sizeof(ml_result_t), NULL);
-  
-  // Create all tasks using osThreadNew (CMSIS-RTOS v2 method)
-  heartbeatTaskHandle = osThreadNew(heartbeat_monitor_task, NULL, &heartbeat_monitor_attributes);
-  mlTaskHandle = osThreadNew(ml_inference_task, NULL, &ml_inference_attributes);
-  ledTaskHandle = osThreadNew(led_controller_task, NULL, &led_controller_attributes);
-  faultTaskHandle = osThreadNew(fault_handler_task, NULL, &fault_handler_attributes);
-  resetTaskHandle = osThreadNew(reset_control_task, NULL, &reset_control_attributes);
-  ttcTaskHandle = osThreadNew(ttc_monitor_task, NULL, &ttc_monitor_attributes);
-  watchdogTaskHandle = osThreadNew(watchdog_manager_task, NULL, &watchdog_manager_attributes);
+  faultQueueHandle = osMessageQueueNew(FAULT_QUEUE_DEPTH, sizeof(ml_result_t), &fault_queue_attributes);
+  if (faultQueueHandle == NULL) {
+    Error_Handler();
+  }
+
+  // Create every task in the table; all memory is static, so a failure
+  // here is a configuration error and must not go unnoticed
+  for (uint32_t i = 0; i < sizeof(rtos_tasks) / sizeof(rtos_tasks[0]); i++) {
+    *rtos_tasks[i].handle = osThreadNew(rtos_tasks[i].entry, NULL, &rtos_tasks[i].attr);
+    if (*rtos_tasks[i].handle == NULL) {
+      Error_Handler();
+    }
+  }
 
   /* USER CODE END Init */
 
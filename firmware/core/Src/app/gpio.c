@@ -22,6 +22,9 @@
 #include "gpio.h"
 
 /* USER CODE BEGIN 0 */
+#include "reset_control.h"
+#include "fast_rules.h"
+#include "memory_map.h"
 
 /* USER CODE END 0 */
 
@@ -204,5 +207,26 @@ void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 2 */
+ITCM_FUNC void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+  // Reset sources are posted to the reset arbiter task, not handled here
+  switch (GPIO_Pin)
+  {
+    case WDOG_DONE_PIN:
+      reset_control_request_from_isr(RESET_SRC_WATCHDOG);
+      break;
+    case PWR_SUPERVISOR_PIN:
+      reset_control_request_from_isr(RESET_SRC_POWER_SUPERVISOR);
+      break;
+    case MANUAL_RESET_PIN:
+      reset_control_request_from_isr(RESET_SRC_MANUAL);
+      break;
+    case HEARTBEAT_IN_PIN:
+      fast_rules_heartbeat_edge_from_isr();
+      break;
+    default:
+      break;
+  }
+}
 
 /* USER CODE END 2 */
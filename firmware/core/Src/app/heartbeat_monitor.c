@@ -1,6 +1,8 @@
 #include "heartbeat_monitor.h"
 #include "fault_detection.h"
 #include "led_control.h"
+#include "clock_mode.h"
+#include "fast_rules.h"
 #include <string.h>
 
 // Heartbeat monitoring variables
@@ -10,6 +12,12 @@ static uint32_t heartbeat_pulse_count = 0;
 static uint32_t last_heartbeat_check = 0;
 static uint8_t heartbeat_healthy = 1;
 
+// Heartbeat LED flash per received pulse, cleared by expiry
+#define HEARTBEAT_LED_FLASH_MS 50
+static const led_indication_t heartbeat_pulse = {
+    LED_PRIORITY_HEARTBEAT, LED_MASK(LED_HEARTBEAT), LED_MASK(LED_HEARTBEAT), 0, 0, NULL,
+};
+
 // Our own heartbeat generation
 static uint32_t our_heartbeat_last_toggle = 0;
 static uint8_t our_heartbeat_state = 0;
@@ -49,7 +57,7 @@ void heartbeat_monitor_task(void *argument) {
                 heartbeat_healthy = 1;
                 
                 // Update heartbeat LED
-                set_led(LED_HEARTBEAT, 1);
+                led_compositor_post(LED_SOURCE_HEARTBEAT, &heartbeat_pulse, HEARTBEAT_LED_FLASH_MS);
             }
             last_pulse_time = current_time;
         }
@@ -57,20 +65,23 @@ void heartbeat_monitor_task(void *argument) {
         // Clear pulse detection after debounce period
         if (last_pulse_time > 0 && (current_time - last_pulse_time) > 10) {
             last_pulse_time = 0;
-            set_led(LED_HEARTBEAT, 0);
         }
 
         // Check for heartbeat timeout (5 seconds)
         if ((current_time - last_heartbeat_time) > pdMS_TO_TICKS(HEARTBEAT_TIMEOUT_MS)) {
             if (heartbeat_healthy) {
-                // Heartbeat just failed - trigger fault
+                // Heartbeat just failed - trigger fault, unless the
+                // deadline interrupt already did
                 heartbeat_healthy = 0;
-                ml_result_t fault = {
-                    .predicted_class = 1, // OBC fault - no heartbeat
-                    .confidence = 0.95f, 
-                    .timestamp = current_time
-                };
-                osMessageQueuePut(faultQueueHandle, &fault, 0, 0);
+                if (!fast_rules_claimed(1)) {
+                    clock_mode_request(CLOCK_REASON_HEARTBEAT);
+                    ml_result_t fault = {
+                        .predicted_class = 1, // OBC fault - no heartbeat
+                        .confidence = 0.95f, 
+                        .timestamp = current_time
+                    };
+                    osMessageQueuePut(faultQueueHandle, &fault, 0, 0);
+                }
             }
         }
 
@@ -0,0 +1,236 @@
+#include "led_animation.h"
+#include <string.h>
+
+// Raised sine, (1 + sin(2*pi*i/256)) / 2 scaled to 0..255
+static const uint8_t sine_table[256] = {
+    128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173,
+    176, 179, 182, 185, 188, 190, 193, 196, 198, 201, 203, 206, 208, 211, 213, 215,
+    218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 241, 243, 244,
+    245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255,
+    255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
+    245, 244, 243, 241, 240, 238, 237, 235, 234, 232, 230, 228, 226, 224, 222, 220,
+    218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 179,
+    176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131,
+    128, 124, 121, 118, 115, 112, 109, 106, 103, 100,  97,  93,  90,  88,  85,  82,
+     79,  76,  73,  70,  67,  65,  62,  59,  57,  54,  52,  49,  47,  44,  42,  40,
+     37,  35,  33,  31,  29,  27,  25,  23,  21,  20,  18,  17,  15,  14,  12,  11,
+     10,   9,   7,   6,   5,   5,   4,   3,   2,   2,   1,   1,   1,   0,   0,   0,
+      0,   0,   0,   0,   1,   1,   1,   2,   2,   3,   4,   5,   5,   6,   7,   9,
+     10,  11,  12,  14,  15,  17,  18,  20,  21,  23,  25,  27,  29,  31,  33,  35,
+     37,  40,  42,  44,  47,  49,  52,  54,  57,  59,  62,  65,  67,  70,  73,  76,
+     79,  82,  85,  88,  90,  93,  97, 100, 103, 106, 109, 112, 115, 118, 121, 124,
+};
+
+// Perceptual brightness, gamma 2.2
+static const uint8_t gamma_table[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+// Boot: chase, then the RGB self test that enter_diagnostic_mode used to
+// run with osDelay, then steady green
+static const led_keyframe_t rgb_test_keyframes[] = {
+    {0,    {255, 0, 0}},
+    {500,  {0, 255, 0}},
+    {1000, {0, 0, 255}},
+    {1500, {0, 255, 0}},
+};
+
+const led_animation_t led_animation_normal = {
+    .effect = LED_EFFECT_SOLID,
+    .color = {0, 255, 0},
+    .period_ms = 1000,
+};
+
+static const led_animation_t led_animation_rgb_test = {
+    .effect = LED_EFFECT_KEYFRAMES,
+    .period_ms = 2000,
+    .repeats = 1,
+    .keyframe_count = sizeof(rgb_test_keyframes) / sizeof(rgb_test_keyframes[0]),
+    .keyframes = rgb_test_keyframes,
+    .next = &led_animation_normal,
+};
+
+const led_animation_t led_animation_boot = {
+    .effect = LED_EFFECT_CHASE,
+    .color = {255, 255, 255},
+    .period_ms = 300,
+    .repeats = 3,
+    .next = &led_animation_rgb_test,
+};
+
+// Written by any task (or before the scheduler), taken by the LED task
+static const led_animation_t *volatile requested = NULL;
+
+static const led_animation_t *current = NULL;
+static uint32_t start_ms = 0;
+static ws2812b_color_t last_frame[WS2812B_NUM_LEDS];
+static uint8_t frame_valid = 0;
+
+// Runtime copies for the parameterised patterns below
+static led_animation_t chase_animation;
+static led_animation_t breathe_animation;
+
+static uint8_t scale8(uint8_t value, uint8_t level) {
+    return (uint8_t)(((uint16_t)value * level + 255) >> 8);
+}
+
+static ws2812b_color_t dim(ws2812b_color_t color, uint8_t level) {
+    ws2812b_color_t out = {
+        gamma_table[scale8(color.red, level)],
+        gamma_table[scale8(color.green, level)],
+        gamma_table[scale8(color.blue, level)],
+    };
+    return out;
+}
+
+static uint8_t lerp8(uint8_t from, uint8_t to, uint8_t weight) {
+    return (uint8_t)(from + (((int16_t)to - from) * weight) / 256);
+}
+
+static ws2812b_color_t keyframe_color(const led_animation_t *anim, uint32_t offset_ms) {
+    const led_keyframe_t *keys = anim->keyframes;
+    uint8_t count = anim->keyframe_count;
+    uint8_t k = 0;
+
+    if (keys == NULL || count == 0) {
+        return (ws2812b_color_t){0, 0, 0};
+    }
+    if (count > LED_ANIMATION_MAX_KEYFRAMES) {
+        count = LED_ANIMATION_MAX_KEYFRAMES;
+    }
+
+    // Bounded by LED_ANIMATION_MAX_KEYFRAMES
+    while (k + 1 < count && offset_ms >= keys[k + 1].at_ms) {
+        k++;
+    }
+
+    if (!anim->interpolate) {
+        return keys[k].color;
+    }
+
+    // Blend towards the next keyframe, wrapping to the first
+    const led_keyframe_t *from = &keys[k];
+    const led_keyframe_t *to = &keys[(k + 1) % count];
+    uint32_t span = (k + 1 < count) ? (uint32_t)(to->at_ms - from->at_ms)
+                                    : (uint32_t)(anim->period_ms - from->at_ms + to->at_ms);
+    uint8_t weight = span ? (uint8_t)(((offset_ms - from->at_ms) * 256U) / span) : 0;
+
+    ws2812b_color_t out = {
+        lerp8(from->color.red, to->color.red, weight),
+        lerp8(from->color.green, to->color.green, weight),
+        lerp8(from->color.blue, to->color.blue, weight),
+    };
+    return out;
+}
+
+static void render(const led_animation_t *anim, uint32_t offset_ms, ws2812b_color_t *leds) {
+    // 8-bit phase of the period, one division per step
+    uint8_t phase = (uint8_t)((offset_ms * 256U) / anim->period_ms);
+
+    for (int i = 0; i < WS2812B_NUM_LEDS; i++) {
+        uint8_t led_phase = (uint8_t)(phase + i * anim->led_phase);
+
+        switch (anim->effect) {
+            case LED_EFFECT_BLINK:
+                leds[i] = dim(anim->color, (led_phase < 128) ? 255 : 0);
+                break;
+            case LED_EFFECT_BREATHE:
+                leds[i] = dim(anim->color, sine_table[led_phase]);
+                break;
+            case LED_EFFECT_CHASE:
+                leds[i] = dim(anim->color, (((uint16_t)phase * WS2812B_NUM_LEDS) >> 8) == i ? 255 : 0);
+                break;
+            case LED_EFFECT_KEYFRAMES: {
+                uint32_t shifted = (offset_ms + ((uint32_t)i * anim->led_phase * anim->period_ms) / 256U)
+                                   % anim->period_ms;
+                leds[i] = dim(keyframe_color(anim, shifted), 255);
+                break;
+            }
+            case LED_EFFECT_SOLID:
+            default:
+                leds[i] = dim(anim->color, 255);
+                break;
+        }
+    }
+}
+
+void led_animation_play(const led_animation_t *animation) {
+    requested = animation;
+}
+
+void led_animation_step(uint32_t now_ms) {
+    ws2812b_color_t leds[WS2812B_NUM_LEDS];
+
+    const led_animation_t *request = requested;
+    if (request != NULL) {
+        requested = NULL;
+        current = request;
+        start_ms = now_ms;
+    }
+
+    if (current == NULL || current->period_ms == 0) {
+        return;
+    }
+
+    uint32_t elapsed = now_ms - start_ms;
+    uint32_t periods = elapsed / current->period_ms;
+
+    if (current->repeats != 0 && periods >= current->repeats) {
+        if (current->next == NULL) {
+            // Hold the last frame
+            return;
+        }
+        start_ms += (uint32_t)current->repeats * current->period_ms;
+        current = current->next;
+        elapsed = now_ms - start_ms;
+        if (current->period_ms == 0) {
+            return;
+        }
+    }
+
+    render(current, elapsed % current->period_ms, leds);
+
+    // Only touch the strip when something changed
+    if (frame_valid && memcmp(leds, last_frame, sizeof(leds)) == 0) {
+        return;
+    }
+    memcpy(last_frame, leds, sizeof(leds));
+    frame_valid = 1;
+    ws2812b_set_colors(leds, WS2812B_NUM_LEDS);
+}
+
+void ws2812b_chase_pattern(ws2812b_color_t color, uint16_t num_cycles) {
+    // 100 ms per position, as the blocking version did
+    chase_animation = (led_animation_t){
+        .effect = LED_EFFECT_CHASE,
+        .color = color,
+        .period_ms = 100 * WS2812B_NUM_LEDS,
+        .repeats = (uint8_t)(num_cycles > 255 ? 255 : num_cycles),
+    };
+    led_animation_play(&chase_animation);
+}
+
+void ws2812b_breathe_pattern(ws2812b_color_t color, uint16_t duration_ms) {
+    breathe_animation = (led_animation_t){
+        .effect = LED_EFFECT_BREATHE,
+        .color = color,
+        .period_ms = duration_ms ? duration_ms : LED_ANIMATION_STEP_MS,
+        .repeats = 1,
+    };
+    led_animation_play(&breathe_animation);
+}
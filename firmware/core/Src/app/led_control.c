@@ -1,27 +1,67 @@
 #include "led_control.h"
 #include "cmsis_os.h"
+#include <string.h>
 
 // LED control array - EXACT MATCH with hardware design
 led_control_t system_leds[LED_COUNT] = {
     {GPIOC, GPIO_PIN_0, 1000, 0, 0, 0, "ML_ACTIVE"},      // PC0
     {GPIOC, GPIO_PIN_1, 0, 0, 0, 0, "FAULT_DBC"},         // PC1
-    {GPIOC, GPIO_PIN_2, 0, 0, 0, 0, "FAULT_TTC"},         // PC2  
+    {GPIOC, GPIO_PIN_2, 0, 0, 0, 0, "FAULT_TTC"},         // PC2
     {GPIOC, GPIO_PIN_3, 500, 0, 0, 0, "WARNING"},         // PC3
     {GPIOC, GPIO_PIN_4, 1000, 0, 0, 0, "HEARTBEAT"},      // PC4
     {GPIOC, GPIO_PIN_5, 200, 0, 0, 0, "COMM_ACTIVE"},     // PC5
     {GPIOC, GPIO_PIN_9, 0, 0, 0, 0, "SYS_OK"}             // PC9
 };
 
-// Pre-defined colors for system states
-const rgb_color_t COLOR_NORMAL = {0, 255, 0};        // Green
-const rgb_color_t COLOR_ML_ACTIVE = {0, 0, 255};     // Blue
-const rgb_color_t COLOR_WARNING = {255, 255, 0};     // Yellow
-const rgb_color_t COLOR_DBC_FAULT = {255, 0, 0};     // Red
-const rgb_color_t COLOR_TTC_FAULT = {128, 0, 128};   // Purple
-const rgb_color_t COLOR_CRITICAL = {255, 0, 0};      // Red
-const rgb_color_t COLOR_BOOT = {255, 255, 255};      // White
-const rgb_color_t COLOR_CYAN = {0, 255, 255};        // Cyan
-const rgb_color_t COLOR_ORANGE = {255, 165, 0};      // Orange
+// ML fault indication is held this long after the last inference result
+#define ML_INDICATION_TTL_MS 5000
+
+// Shared with the system state indications
+const led_animation_t rgb_obc_fault = {
+    .effect = LED_EFFECT_SOLID, .color = {255, 0, 0}, .period_ms = 1000,
+};
+static const led_animation_t rgb_overcurrent = {
+    .effect = LED_EFFECT_SOLID, .color = {255, 255, 0}, .period_ms = 1000,
+};
+const led_animation_t rgb_ttc_fault = {
+    .effect = LED_EFFECT_SOLID, .color = {128, 0, 128}, .period_ms = 1000,
+};
+static const led_animation_t rgb_data_corruption = {
+    .effect = LED_EFFECT_SOLID, .color = {255, 165, 0}, .period_ms = 1000,
+};
+
+#define ML_FAULT_LEDS (LED_MASK(LED_FAULT_DBC) | LED_MASK(LED_FAULT_TTC) | \
+                       LED_MASK(LED_WARNING) | LED_MASK(LED_SYS_OK))
+
+// Indication per model class:
+// Class 0: Normal operation
+// Class 1: OBC heartbeat fault
+// Class 2: Power overcurrent
+// Class 3: TTC communication fault
+// Class 4: Data corruption
+static const led_indication_t ml_indications[] = {
+    {LED_PRIORITY_ML, ML_FAULT_LEDS, LED_MASK(LED_SYS_OK), 0, 0, NULL},
+    {LED_PRIORITY_ML, ML_FAULT_LEDS, LED_MASK(LED_FAULT_DBC), 0, 0, &rgb_obc_fault},
+    {LED_PRIORITY_ML, LED_MASK(LED_WARNING), 0, LED_MASK(LED_WARNING), 250, &rgb_overcurrent},
+    {LED_PRIORITY_ML, ML_FAULT_LEDS, LED_MASK(LED_FAULT_TTC), 0, 0, &rgb_ttc_fault},
+    {LED_PRIORITY_ML, LED_MASK(LED_WARNING), 0, LED_MASK(LED_WARNING), 100, &rgb_data_corruption},
+};
+
+const led_indication_t led_indication_boot = {
+    LED_PRIORITY_BOOT, LED_MASK(LED_SYS_OK), 0, LED_MASK(LED_SYS_OK), 500, &led_animation_boot,
+};
+
+typedef struct {
+    led_indication_t indication;
+    uint32_t expires;           // Tick, 0 = until cleared
+    uint8_t active;
+} led_layer_t;
+
+static led_layer_t layers[LED_SOURCE_COUNT];
+
+static uint8_t output_mask = 0;
+static uint8_t output_valid = 0;
+static const led_animation_t *rgb_playing = NULL;
 
 void led_system_init(void) {
     // LEDs are initialized by CubeMX GPIO init
@@ -29,88 +69,149 @@ void led_system_init(void) {
     for(int i = 0; i < LED_COUNT; i++) {
         HAL_GPIO_WritePin(system_leds[i].port, system_leds[i].pin, GPIO_PIN_RESET);
     }
+
+    memset(layers, 0, sizeof(layers));
+    output_mask = 0;
+    output_valid = 0;
+    rgb_playing = NULL;
 }
 
 void set_led(led_id_t led_id, uint8_t state) {
     if(led_id < LED_COUNT) {
         system_leds[led_id].current_state = state;
-        HAL_GPIO_WritePin(system_leds[led_id].port, system_leds[led_id].pin, 
+        HAL_GPIO_WritePin(system_leds[led_id].port, system_leds[led_id].pin,
                          state ? GPIO_PIN_SET : GPIO_PIN_RESET);
+        // The next render rewrites every LED
+        output_valid = 0;
     }
 }
 
-void set_led_blink_rate(led_id_t led_id, uint32_t interval_ms) {
-    if(led_id < LED_COUNT) {
-        system_leds[led_id].blink_interval_ms = interval_ms;
-        system_leds[led_id].last_toggle_time = osKernelGetTickCount();
+// PRIMASK rather than a kernel critical section: boot code posts before
+// the scheduler starts
+void led_compositor_post(led_source_t source, const led_indication_t *indication, uint32_t ttl_ms) {
+    if (source >= LED_SOURCE_COUNT || indication == NULL) {
+        return;
     }
-}
 
-void update_leds_task(void) {
-    uint32_t current_time = osKernelGetTickCount();
-    
-    for(int i = 0; i < LED_COUNT; i++) {
-        if(system_leds[i].blink_interval_ms > 0) {
-            if((current_time - system_leds[i].last_toggle_time) >= 
-               system_leds[i].blink_interval_ms) {
-                // Toggle LED state
-                system_leds[i].current_state = !system_leds[i].current_state;
-                HAL_GPIO_WritePin(system_leds[i].port, system_leds[i].pin,
-                                 system_leds[i].current_state ? GPIO_PIN_SET : GPIO_PIN_RESET);
-                system_leds[i].last_toggle_time = current_time;
-            }
-        }
+    uint32_t expires = 0;
+    if (ttl_ms > 0) {
+        // 0 is reserved for "no expiry"
+        expires = (osKernelGetTickCount() + pdMS_TO_TICKS(ttl_ms)) | 1U;
     }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    layers[source].indication = *indication;
+    layers[source].expires = expires;
+    layers[source].active = 1;
+    __set_PRIMASK(primask);
 }
 
-void update_leds_from_ml_result(ml_result_t* result) {
-    // Reset all fault indicators
-    set_led(LED_FAULT_DBC, 0);
-    set_led(LED_FAULT_TTC, 0);
-    set_led(LED_WARNING, 0);
-    
-    switch(result->predicted_class) {
-        case 0: // Normal
-            set_led(LED_SYS_OK, 1);
-            ws2812b_set_color(COLOR_NORMAL);
-            break;
-        case 1: // OBC Fault (No heartbeat)
-            set_led(LED_FAULT_DBC, 1);
-            set_led(LED_SYS_OK, 0);
-            ws2812b_set_color(COLOR_DBC_FAULT);
-            break;
-        case 2: // Overcurrent
-            set_led(LED_WARNING, 1);
-            set_led_blink_rate(LED_WARNING, 250);
-            ws2812b_set_color(COLOR_WARNING);
-            break;
-        case 3: // TTC Fault
-            set_led(LED_FAULT_TTC, 1);
-            set_led(LED_SYS_OK, 0);
-            ws2812b_set_color(COLOR_TTC_FAULT);
-            break;
-        case 4: // Data corruption
-            set_led(LED_WARNING, 1);
-            set_led_blink_rate(LED_WARNING, 100);
-            ws2812b_set_color(COLOR_ORANGE);
-            break;
+void led_compositor_clear(led_source_t source) {
+    if (source >= LED_SOURCE_COUNT) {
+        return;
     }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    layers[source].active = 0;
+    __set_PRIMASK(primask);
 }
-void led_controller_task(void *argument) {
-    const TickType_t xFrequency = pdMS_TO_TICKS(50); // 20Hz update
-    
-    for(;;) {
-        update_leds_task(); // Update LED blinking states
-        vTaskDelay(xFrequency);
+
+static void led_write_outputs(uint8_t on_mask) {
+    GPIO_TypeDef *ports[LED_COUNT];
+    uint32_t bsrr[LED_COUNT];
+    int port_count = 0;
+
+    // Collect set and reset bits per port, then one BSRR write each
+    for (int i = 0; i < LED_COUNT; i++) {
+        int p = 0;
+        while (p < port_count && ports[p] != system_leds[i].port) {
+            p++;
+        }
+        if (p == port_count) {
+            ports[p] = system_leds[i].port;
+            bsrr[p] = 0;
+            port_count++;
+        }
+
+        uint8_t on = (on_mask >> i) & 1U;
+        bsrr[p] |= on ? system_leds[i].pin : ((uint32_t)system_leds[i].pin << 16);
+        system_leds[i].current_state = on;
+    }
+
+    for (int p = 0; p < port_count; p++) {
+        ports[p]->BSRR = bsrr[p];
     }
 }
 
-// WS2812B Driver (simplified - you'll need to implement timing-specific code)
-void ws2812b_set_color(rgb_color_t color) {
-    // Implementation depends on your specific WS2812B connection
-    // This is a placeholder - you'll need to implement the precise timing
+void led_compositor_render(uint32_t now) {
+    led_layer_t snapshot[LED_SOURCE_COUNT];
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    for (int s = 0; s < LED_SOURCE_COUNT; s++) {
+        if (layers[s].active && layers[s].expires != 0 &&
+            (int32_t)(now - layers[s].expires) >= 0) {
+            layers[s].active = 0;
+        }
+    }
+    memcpy(snapshot, layers, sizeof(snapshot));
+    __set_PRIMASK(primask);
+
+    uint8_t on_mask = 0;
+    const led_animation_t *rgb = NULL;
+    uint8_t rgb_priority = 0;
+
+    for (int i = 0; i < LED_COUNT; i++) {
+        const led_indication_t *winner = NULL;
+
+        for (int s = 0; s < LED_SOURCE_COUNT; s++) {
+            const led_indication_t *ind = &snapshot[s].indication;
+            if (snapshot[s].active && (ind->drive_mask & LED_MASK(i)) &&
+                (winner == NULL || ind->priority > winner->priority)) {
+                winner = ind;
+            }
+        }
+
+        if (winner == NULL || winner->priority == 0) {
+            continue;
+        }
+        if (winner->on_mask & LED_MASK(i)) {
+            on_mask |= LED_MASK(i);
+        } else if ((winner->blink_mask & LED_MASK(i)) && winner->blink_ms > 0 &&
+                   ((now / winner->blink_ms) & 1U) == 0) {
+            on_mask |= LED_MASK(i);
+        }
+    }
+
+    for (int s = 0; s < LED_SOURCE_COUNT; s++) {
+        const led_indication_t *ind = &snapshot[s].indication;
+        if (snapshot[s].active && ind->rgb != NULL && ind->priority > rgb_priority) {
+            rgb = ind->rgb;
+            rgb_priority = ind->priority;
+        }
+    }
+
+    // GPIO only when an LED actually changes
+    if (!output_valid || on_mask != output_mask) {
+        led_write_outputs(on_mask);
+        output_mask = on_mask;
+        output_valid = 1;
+    }
+
+    if (rgb != NULL && rgb != rgb_playing) {
+        led_animation_play(rgb);
+    }
+    rgb_playing = rgb;
+    led_animation_step(now);
 }
 
-void ws2812b_chase_pattern(rgb_color_t color) {
-    // Implement chase pattern for boot sequence
-}
\ No newline at end of file
+void update_leds_from_ml_result(ml_result_t* result) {
+    if (result->predicted_class >= sizeof(ml_indications) / sizeof(ml_indications[0])) {
+        return;
+    }
+
+    led_compositor_post(LED_SOURCE_ML, &ml_indications[result->predicted_class],
+                        ML_INDICATION_TTL_MS);
+}
@@ -0,0 +1,280 @@
+#include "low_power.h"
+#include "cycle_counter.h"
+#include "runtime_stats.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+#define LPTIM_COUNTS_PER_TICK(hz) ((hz) / configTICK_RATE_HZ)
+
+static low_power_stats_t stats;
+static uint32_t lptim_hz = 0;
+
+// LPTIM counts that did not add up to a whole tick, carried to the next sleep
+static uint32_t residual_counts = 0;
+
+static uint16_t lptim_read(void) {
+    // CNT is clocked asynchronously: two equal reads in a row are valid
+    uint16_t first;
+    uint16_t second;
+
+    do {
+        first = (uint16_t)LPTIM1->CNT;
+        second = (uint16_t)LPTIM1->CNT;
+    } while (first != second);
+
+    return first;
+}
+
+static void lptim_set_compare(uint16_t value) {
+    LPTIM1->ICR = LPTIM_ICR_CMPOKCF;
+    LPTIM1->CMP = value;
+    while (!(LPTIM1->ISR & LPTIM_ISR_CMPOK)) {}
+    LPTIM1->ICR = LPTIM_ICR_CMPOKCF | LPTIM_ICR_CMPMCF;
+}
+
+static uint8_t low_power_start_lse(void) {
+    uint32_t start = HAL_GetTick();
+
+    // LSE lives in the backup domain
+    HAL_PWR_EnableBkUpAccess();
+    __HAL_RCC_LSE_CONFIG(RCC_LSE_ON);
+
+    // Polled from boot_task, so yield to the tasks below it meanwhile
+    while (!__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY)) {
+        if ((HAL_GetTick() - start) > LOW_POWER_LSE_TIMEOUT_MS) {
+            __HAL_RCC_LSE_CONFIG(RCC_LSE_OFF);
+            return 0;
+        }
+        osDelay(1);
+    }
+    return 1;
+}
+
+static uint32_t low_power_calibrate(void) {
+    // Count core cycles over a few LPTIM periods. Needed for the LSI
+    // fallback (+-10%) and harmless with the crystal.
+    uint16_t start = lptim_read();
+    while (lptim_read() == start) {}
+
+    start = lptim_read();
+    uint32_t cycles_start = cycle_counter_now();
+    while ((uint16_t)(lptim_read() - start) < LOW_POWER_CALIBRATION_COUNTS) {}
+    uint32_t cycles = cycle_counter_now() - cycles_start;
+
+    return (uint32_t)(((uint64_t)LOW_POWER_CALIBRATION_COUNTS * SystemCoreClock) / cycles);
+}
+
+static void low_power_restore_clocks(void) {
+    // STOP exit runs from HSI. PLL1 dividers and flash latency survive, so
+    // only HSE and the PLL have to be brought back before switching.
+    __HAL_RCC_HSE_CONFIG(RCC_HSE_BYPASS);
+    while (!__HAL_RCC_GET_FLAG(RCC_FLAG_HSERDY)) {}
+
+    __HAL_RCC_PLL_ENABLE();
+    while (!__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY)) {}
+
+    while (!__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY)) {}
+
+    __HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_PLLCLK);
+    while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_PLLCLK) {}
+}
+
+void low_power_init(void) {
+    memset(&stats, 0, sizeof(stats));
+    residual_counts = 0;
+
+    stats.lse_running = low_power_start_lse();
+    if (stats.lse_running) {
+        __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSE);
+    } else {
+        __HAL_RCC_LSI_ENABLE();
+        while (!__HAL_RCC_GET_FLAG(RCC_FLAG_LSIRDY)) {}
+        __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSI);
+    }
+    __HAL_RCC_LPTIM1_CLK_ENABLE();
+
+    // Free-running up-counter; the compare match is the wake-up event.
+    // IER may only be written while the timer is disabled.
+    LPTIM1->CR = 0;
+    LPTIM1->CFGR = (uint32_t)LOW_POWER_LPTIM_PRESCALER_LOG2 << LPTIM_CFGR_PRESC_Pos;
+    LPTIM1->IER = LPTIM_IER_CMPMIE;
+    LPTIM1->CR = LPTIM_CR_ENABLE;
+
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+    LPTIM1->ARR = 0xFFFF;
+    while (!(LPTIM1->ISR & LPTIM_ISR_ARROK)) {}
+    LPTIM1->ICR = LPTIM_ICR_ARROKCF;
+    lptim_set_compare(0xFFFF);
+
+    LPTIM1->CR |= LPTIM_CR_CNTSTRT;
+
+    // Runs in boot_task: keep other tasks out of the measurement
+    vTaskSuspendAll();
+    lptim_hz = low_power_calibrate();
+    xTaskResumeAll();
+    stats.lptim_hz = lptim_hz;
+
+    // LPTIM1 (line 47) and USART1 (line 41) may wake the core from STOP
+    EXTI_D1->IMR2 |= EXTI_IMR2_IM47 | EXTI_IMR2_IM41;
+
+    HAL_NVIC_SetPriority(LPTIM1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(LPTIM1_IRQn);
+}
+
+void low_power_lptim_irq(void) {
+    // Only here to end WFI; the idle task reads the counter itself
+    LPTIM1->ICR = LPTIM_ICR_CMPMCF;
+}
+
+// FreeRTOS portSUPPRESS_TICKS_AND_SLEEP (configUSE_TICKLESS_IDLE 2), called
+// from the idle task with the scheduler suspended
+void low_power_suppress_ticks_and_sleep(uint32_t expected_idle_ticks) {
+    if (lptim_hz == 0 || expected_idle_ticks < 2) {
+        return;
+    }
+
+    // The last tick is left to SysTick so the waking task is unblocked by
+    // the normal tick path
+    uint32_t sleep_ticks = expected_idle_ticks - 1;
+    uint32_t counts_per_tick = LPTIM_COUNTS_PER_TICK(lptim_hz);
+    uint32_t max_ticks = LOW_POWER_MAX_SLEEP_COUNTS / counts_per_tick;
+    if (sleep_ticks > max_ticks) {
+        sleep_ticks = max_ticks;
+    }
+
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    // A tick or a wake-up arrived since the kernel decided to sleep
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep ||
+        (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) {
+        stats.aborted++;
+        __enable_irq();
+        return;
+    }
+
+    // Time already spent in the current tick period counts toward the sleep
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uint32_t partial_cycles = SysTick->LOAD - SysTick->VAL;
+    residual_counts += (uint32_t)(((uint64_t)partial_cycles * lptim_hz) / SystemCoreClock);
+
+    uint16_t start = lptim_read();
+    uint32_t sleep_counts = sleep_ticks * counts_per_tick;
+    if (sleep_counts > residual_counts) {
+        sleep_counts -= residual_counts;
+    }
+    lptim_set_compare((uint16_t)(start + sleep_counts));
+
+    low_power_mode_t mode = (sleep_ticks >= LOW_POWER_STOP_MIN_TICKS) ?
+                            LOW_POWER_MODE_STOP : LOW_POWER_MODE_SLEEP;
+    uint32_t cycles_before = cycle_counter_now();
+
+    if (mode == LOW_POWER_MODE_STOP) {
+        HAL_PWREx_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI, PWR_D1_DOMAIN);
+
+        // Most of the wake latency is the PLL lock, spent on HSI
+        uint32_t wake_start = cycle_counter_now();
+        low_power_restore_clocks();
+        uint32_t wake_us = (cycle_counter_now() - wake_start) / (HSI_VALUE / 1000000U);
+
+        stats.last_wake_us = wake_us;
+        if (wake_us > stats.worst_wake_us) {
+            stats.worst_wake_us = wake_us;
+        }
+    } else {
+        __DSB();
+        __WFI();
+        __ISB();
+    }
+
+    uint32_t elapsed_counts = (uint16_t)(lptim_read() - start) + residual_counts;
+    uint32_t elapsed_ticks = elapsed_counts / counts_per_tick;
+    residual_counts = elapsed_counts - elapsed_ticks * counts_per_tick;
+
+    low_power_mode_stats_t *mode_stats = &stats.mode[mode];
+    mode_stats->entries++;
+    if (elapsed_ticks < sleep_ticks) {
+        mode_stats->early_wakes++;
+    }
+
+    // Waking after the next task was due: the kernel cannot step past its
+    // unblock time, so the overshoot is lost from the tick count
+    if (elapsed_ticks > sleep_ticks) {
+        uint32_t overshoot = elapsed_ticks - sleep_ticks;
+        if (elapsed_ticks >= expected_idle_ticks) {
+            stats.missed_deadlines++;
+        }
+        if (overshoot > stats.worst_overshoot_ticks) {
+            stats.worst_overshoot_ticks = overshoot;
+        }
+        elapsed_ticks = sleep_ticks;
+        residual_counts = 0;
+    }
+    mode_stats->slept_ticks += elapsed_ticks;
+
+    // The cycle counter is stopped while the core clock is gated; give the
+    // idle task the slept time so CPU load is not overstated. A full
+    // LOW_POWER_MAX_SLEEP_COUNTS sleep is ~15.9 s, past one CYCCNT wrap at
+    // 275 MHz, so this stays 64-bit.
+    uint64_t slept_cycles = ((uint64_t)elapsed_ticks * SystemCoreClock) / configTICK_RATE_HZ;
+    uint32_t counted_cycles = cycle_counter_now() - cycles_before;
+    if (slept_cycles > counted_cycles) {
+        runtime_stats_account_sleep(slept_cycles - counted_cycles);
+    }
+
+    // HAL and kernel ticks both run at 1 kHz
+    uwTick += elapsed_ticks;
+    vTaskStepTick(elapsed_ticks);
+
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    __enable_irq();
+}
+
+void low_power_get_stats(low_power_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t low_power_residency_permille(void) {
+    uint32_t uptime = osKernelGetTickCount();
+    uint32_t slept = stats.mode[LOW_POWER_MODE_SLEEP].slept_ticks +
+                     stats.mode[LOW_POWER_MODE_STOP].slept_ticks;
+
+    if (uptime == 0) {
+        return 0;
+    }
+    return (uint16_t)(((uint64_t)slept * 1000U) / uptime);
+}
+
+uint16_t low_power_build_report(uint8_t *buffer, uint16_t size) {
+    low_power_stats_t snapshot;
+    uint16_t residency = low_power_residency_permille();
+
+    if (size < LOW_POWER_REPORT_SIZE) {
+        return 0;
+    }
+
+    low_power_get_stats(&snapshot);
+
+    buffer[0] = snapshot.lse_running;
+
+    uint8_t *p = ttc_put_u16(&buffer[1], residency);
+    for (int i = 0; i < LOW_POWER_MODE_COUNT; i++) {
+        p = ttc_put_u32(p, snapshot.mode[i].entries);
+        p = ttc_put_u32(p, snapshot.mode[i].slept_ticks);
+        p = ttc_put_u32(p, snapshot.mode[i].early_wakes);
+    }
+    p = ttc_put_u32(p, snapshot.aborted);
+    p = ttc_put_u32(p, snapshot.missed_deadlines);
+    p = ttc_put_u32(p, snapshot.worst_overshoot_ticks);
+    p = ttc_put_u32(p, snapshot.last_wake_us);
+    p = ttc_put_u32(p, snapshot.worst_wake_us);
+    ttc_put_u32(p, snapshot.lptim_hz);
+
+    return LOW_POWER_REPORT_SIZE;
+}
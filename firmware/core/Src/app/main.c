@@ -28,14 +28,22 @@
 #include "reset_control.h" 
 #include "fault_detection.h"
 #include "ws2812b_driver.h"
+#include "led_animation.h"
+#include "system_state.h"
 #include "ml_integration.h"
 #include "ttc_communication.h"
 #include "watchdog_manager.h"
 #include "system_test.h"
+#include "blackbox.h"
+#include "crash_context.h"
+#include "cycle_counter.h"
+#include "mpu_map.h"
+#include "clock_mode.h"
+#include "boot_timeline.h"
+#include "system_init.h"
 
 /* Private variables ---------------------------------------------------------*/
 reset_control_t system_reset = {0};
-system_state_t current_system_state = SYS_STATE_BOOT;
 osMessageQueueId_t faultQueueHandle;
 
 // WS2812B Timer handle (replace with your actual timer)
@@ -48,13 +56,6 @@ void MX_FREERTOS_Init(void);
 
 // Add missing task function prototypes
 void led_controller_task(void *argument);
-void watchdog_manager_task(void *argument);
-void fault_handler_task(void *argument);
-
-// Add system initialization function
-void system_startup_sequence(void);
-void enter_diagnostic_mode(void);
-void load_ml_model(void);
 
 /* USER CODE BEGIN PFP */
 
@@ -71,6 +72,15 @@ void load_ml_model(void);
   */
 int main(void)
 {
+  /* USER CODE BEGIN 1 */
+  // Latch RCC_RSR and the retained crash context before anything resets them
+  crash_context_init();
+
+  // DWT cycle counter for latency and timing measurements
+  cycle_counter_init();
+  boot_timeline_init();
+  /* USER CODE END 1 */
+
   /* MPU Configuration--------------------------------------------------------*/
   MPU_Config();
 
@@ -84,6 +94,10 @@ int main(void)
   /* Configure the system clock */
   SystemClock_Config();
 
+  /* USER CODE BEGIN SysInit */
+  boot_timeline_mark(BOOT_STEP_CLOCKS);
+  /* USER CODE END SysInit */
+
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
   MX_ADC1_Init();
@@ -92,15 +106,21 @@ int main(void)
   MX_X_CUBE_AI_Init();
 
   /* USER CODE BEGIN 2 */
-  // Initialize subsystems AFTER peripherals are configured
+  boot_timeline_mark(BOOT_STEP_PERIPHERALS);
+
+  // Initialize subsystems AFTER peripherals are configured. Only
+  // non-blocking setup belongs here; low_power_init (LSE start-up) runs
+  // in boot_task once the scheduler is up.
   led_system_init();
   reset_controller_init();
   watchdog_manager_init();
+  blackbox_init();
   
   // Initialize WS2812B driver with timer (replace with your timer and channel)
   ws2812b_init(&htim2, TIM_CHANNEL_1);  // Adjust to your timer configuration
+  clock_mode_init();
   
-  // Run system startup sequence (includes self-test)
+  // Boot LEDs; model loading and self test continue in their own tasks
   system_startup_sequence();
   /* USER CODE END 2 */
 
@@ -183,102 +203,19 @@ void SystemClock_Config(void)
 
 /* USER CODE BEGIN 4 */
 
-// System startup sequence with WS2812B integration
-void system_startup_sequence(void) {
-    // Boot sequence with LED diagnostics
-    ws2812b_chase_pattern(COLOR_BOOT, 3);  // 3 cycles of chase pattern
-
-    // Step 1: MCU initialization
-    set_led_blink_rate(LED_SYS_OK, 500);
-
-    // Step 2: Reset circuit initialization
-    reset_controller_init();
-
-    // Step 3: Peripheral initialization
-    enter_diagnostic_mode();
-
-    // Step 4: ML model loading
-    set_led(LED_ML_ACTIVE, 1);
-    load_ml_model();
-    set_led(LED_ML_ACTIVE, 0);
-
-    // Step 5: System ready - start autonomous monitoring
-    set_led(LED_SYS_OK, 1);
-    ws2812b_set_simple_color(COLOR_NORMAL);  // Set all RGB LEDs to green
-    
-    // Update system state
-    current_system_state = SYS_STATE_NORMAL;
-}
-
-void enter_diagnostic_mode(void) {
-    // Flash all LEDs in sequence for diagnostic
-    for(int i = 0; i < LED_COUNT; i++) {
-        set_led(i, 1);
-        osDelay(200);
-        set_led(i, 0);
-    }
-    
-    // Test RGB LED with different colors
-    ws2812b_set_simple_color(COLOR_RED);
-    osDelay(500);
-    ws2812b_set_simple_color(COLOR_GREEN);
-    osDelay(500);
-    ws2812b_set_simple_color(COLOR_BLUE);
-    osDelay(500);
-    ws2812b_set_simple_color(COLOR_NORMAL);
-}
-
-void load_ml_model(void) {
-    // Load ML model - implementation depends on STM32Cube.AI
-    // This is called by the startup sequence
-    osDelay(1000); // Simulate loading time
-}
+// system_startup_sequence and boot_task live in system_init.c
 
 // Add missing task implementations
 void led_controller_task(void *argument) {
     const TickType_t xFrequency = pdMS_TO_TICKS(50); // 20Hz update
     
     for(;;) {
-        update_leds_task(); // Update LED blinking states
+        // GPIO LEDs and the RGB strip from every subsystem's request
+        led_compositor_render(osKernelGetTickCount());
         vTaskDelay(xFrequency);
     }
 }
 
-void watchdog_manager_task(void *argument) {
-    // Use the corrected watchdog manager task
-    TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(500); // 2Hz update
-    
-    if (!watchdog_initialized) {
-        watchdog_manager_init();
-    }
-    
-    for(;;) {
-        // Toggle WDOG_WAKE pin to keep watchdog alive
-        HAL_GPIO_TogglePin(WDOG_WAKE_PORT, WDOG_WAKE_PIN);
-        last_watchdog_ping = xTaskGetTickCount();
-        
-        // Check if watchdog has timed out
-        if (watchdog_check_timeout()) {
-            // Watchdog timeout detected - trigger system reset
-            system_reset.watchdog_reset = 1;
-        }
-        
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
-    }
-}
-
-void fault_handler_task(void *argument) {
-    ml_result_t fault;
-    
-    for(;;) {
-        // Wait for fault messages from the queue
-        if (osMessageQueueGet(faultQueueHandle, &fault, NULL, osWaitForever) == osOK) {
-            handle_detected_fault(&fault);
-        }
-    }
-}
-
 // Quick system check function for debugging
 void quick_system_check(void) {
     // Test LED subsystem
@@ -308,28 +245,8 @@ void quick_system_check(void) {
 /* MPU Configuration */
 void MPU_Config(void)
 {
-  MPU_Region_InitTypeDef MPU_InitStruct = {0};
-
-  /* Disables the MPU */
-  HAL_MPU_Disable();
-
-  /** Initializes and configures the Region and the memory to be protected
-  */
-  MPU_InitStruct.Enable = MPU_REGION_ENABLE;
-  MPU_InitStruct.Number = MPU_REGION_NUMBER0;
-  MPU_InitStruct.BaseAddress = 0x0;
-  MPU_InitStruct.Size = MPU_REGION_SIZE_4GB;
-  MPU_InitStruct.SubRegionDisable = 0x87;
-  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
-  MPU_InitStruct.AccessPermission = MPU_REGION_NO_ACCESS;
-  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
-  MPU_InitStruct.IsShareable = MPU_ACCESS_SHAREABLE;
-  MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
-  MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
-
-  HAL_MPU_ConfigRegion(&MPU_InitStruct);
-  /* Enables the MPU */
-  HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+  /* Region map and cache policy are defined in mpu_map.c */
+  mpu_map_apply();
 }
 
 /**
@@ -341,19 +258,24 @@ void Error_Handler(void)
   /* USER CODE BEGIN Error_Handler_Debug */
   /* User can add his own implementation to report the HAL error return state */
   __disable_irq();
+
+  // Record who failed so the next boot can report it
+  crash_context_note_reset(CRASH_REASON_ERROR_HANDLER, (uint32_t)__builtin_return_address(0));
   
   // Set all fault LEDs to indicate error state
   HAL_GPIO_WritePin(GPIOC, GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3, GPIO_PIN_SET);
   
-  // Set RGB LED to critical red
-  ws2812b_set_simple_color(COLOR_CRITICAL);
-  
-  while (1)
+  // Flash warning LED rapidly for ~1 s, then reboot. HAL_Delay cannot be
+  // used here: the tick interrupt is masked.
+  for (int flash = 0; flash < 10; flash++)
   {
-    // Flash warning LED rapidly
     HAL_GPIO_TogglePin(GPIOC, GPIO_PIN_3);
-    HAL_Delay(100);
+    for (volatile uint32_t spin = 0; spin < (SystemCoreClock / 40U); spin++)
+    {
+    }
   }
+
+  NVIC_SystemReset();
   /* USER CODE END Error_Handler_Debug */
 }
 
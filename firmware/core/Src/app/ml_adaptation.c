@@ -0,0 +1,524 @@
+#include "ml_adaptation.h"
+#include "crc32.h"
+#include "flash_write.h"
+#include "crash_context.h"
+#include "feature_engine.h"
+#include "memory_map.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <stddef.h>
+#include <string.h>
+
+#define ML_ADAPT_LABEL_SIZE 3
+#define ML_ADAPT_LOG_SECTORS 2
+#define ML_ADAPT_LOG_RECORDS (FLASH_SECTOR_SIZE / sizeof(ml_adaptation_record_t))
+#define ML_ADAPT_OUTPUT_WEIGHTS (FAULT_MODEL_OUTPUTS * FAULT_MODEL_HIDDEN2)
+
+typedef struct {
+    uint16_t id;                    // 0 = unused
+    uint8_t predicted_class;
+    uint8_t confidence_pct;
+    uint8_t labelled;
+    float input[FAULT_MODEL_INPUTS];    // Standardised, as the classifier saw it
+} ml_adaptation_event_t;
+
+_Static_assert(FEATURE_MODEL_INPUTS == FAULT_MODEL_INPUTS,
+               "Captured faults are the classifier's inputs");
+
+// Faults raised by ml_inference_task, labelled from ttc_monitor_task
+static ml_adaptation_event_t events[ML_ADAPT_EVENTS];
+static uint8_t next_event = 0;
+static uint16_t last_event_id = 0;
+
+// Labelled inputs per class, oldest first from replay_next - replay_count
+static float replay[FAULT_MODEL_OUTPUTS][ML_ADAPT_REPLAY_PER_CLASS][FAULT_MODEL_INPUTS];
+static uint8_t replay_count[FAULT_MODEL_OUTPUTS];
+static uint8_t replay_next[FAULT_MODEL_OUTPUTS];
+
+// Base weights with gemm_2 adapted, bound to the network while adapted
+static uint8_t adapted[FAULT_MODEL_WEIGHTS_SIZE] __attribute__((aligned(8))) DTCM_BSS;
+static const uint8_t *base_weights = NULL;
+static uint32_t base_crc = 0;
+static ml_model_t *live_model = NULL;
+
+static ml_adaptation_state_t state = ML_ADAPT_OFF;
+static ml_adaptation_status_t last_status = ML_ADAPT_STATUS_OK;
+static uint8_t boot_checked = 0;
+static uint32_t version = 0;
+static uint32_t labels_confirmed = 0;
+static uint32_t labels_corrected = 0;
+static uint32_t records_written = 0;
+static float max_delta = 0.0f;
+static float golden_output[FAULT_MODEL_OUTPUTS];
+
+typedef enum {
+    LOG_SPARE_UNKNOWN = 0,          // Not checked since boot
+    LOG_SPARE_BLANK,                // Erased, ready for when the active one fills
+    LOG_SPARE_DIRTY,                // To be erased
+    LOG_SPARE_STALE,                // Held the log until the last switch, still the newest
+    LOG_SPARE_FAILED                // Erase failed, not retried
+} log_spare_t;
+
+// The log's two sectors, one appended to and one spare. Only
+// ml_adaptation_service and the commands, all in ttc_monitor_task, use it.
+static struct {
+    uint8_t located;
+    uint8_t active;
+    uint32_t next_free;
+    log_spare_t spare;
+    uint8_t pending;                // A record to write
+    uint8_t pending_cleared;
+} log_state;
+
+static float *adapted_weights(void) {
+    return (float *)&adapted[FAULT_MODEL_OUTPUT_WEIGHTS_AT];
+}
+
+static float *adapted_bias(void) {
+    return (float *)&adapted[FAULT_MODEL_OUTPUT_BIAS_AT];
+}
+
+static const ml_adaptation_record_t *log_record(uint8_t sector, uint32_t index) {
+    return (const ml_adaptation_record_t *)(FLASH_WRITE_SECTOR_ADDRESS(FLASH_WRITE_ADAPTATION_SECTOR + sector) +
+                                            index * sizeof(ml_adaptation_record_t));
+}
+
+static uint8_t record_valid(const ml_adaptation_record_t *record) {
+    return record->magic == ML_ADAPT_RECORD_MAGIC &&
+           record->crc == crc32_compute(record, offsetof(ml_adaptation_record_t, crc));
+}
+
+// Newest valid record in one sector, and where the next one goes there.
+// Records are appended in order; one cut short by a reset keeps its place
+// but never validates.
+static const ml_adaptation_record_t *log_scan(uint8_t sector, uint32_t *next_free) {
+    const ml_adaptation_record_t *latest = NULL;
+    uint32_t index = 0;
+
+    for (; index < ML_ADAPT_LOG_RECORDS; index++) {
+        const ml_adaptation_record_t *record = log_record(sector, index);
+
+        if (record->magic == 0xFFFFFFFFUL) {
+            break;
+        }
+        if (record_valid(record)) {
+            latest = record;
+        }
+    }
+
+    *next_free = index;
+    return latest;
+}
+
+// Newest valid record of the whole log, and the sector holding it (the
+// first if there is none)
+static const ml_adaptation_record_t *log_latest(uint8_t *sector, uint32_t *next_free) {
+    const ml_adaptation_record_t *latest = NULL;
+    uint8_t latest_sector = 0;
+    uint32_t latest_free = 0;
+
+    for (uint8_t i = 0; i < ML_ADAPT_LOG_SECTORS; i++) {
+        uint32_t free_at;
+        const ml_adaptation_record_t *record = log_scan(i, &free_at);
+
+        if (i == 0 || (record != NULL && (latest == NULL || record->version > latest->version))) {
+            latest = record;
+            latest_sector = i;
+            latest_free = free_at;
+        }
+    }
+
+    if (sector != NULL) {
+        *sector = latest_sector;
+        *next_free = latest_free;
+    }
+    return latest;
+}
+
+static uint8_t sector_blank(uint8_t sector) {
+    const uint32_t *word = (const uint32_t *)log_record(sector, 0);
+
+    for (uint32_t i = 0; i < FLASH_SECTOR_SIZE / sizeof(uint32_t); i++) {
+        if (word[i] != 0xFFFFFFFFUL) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static ml_adaptation_status_t ml_adaptation_result(ml_adaptation_status_t status) {
+    last_status = status;
+    return status;
+}
+
+// Into the active sector; once that is full, into the spare, which is
+// erased by then. The sector left behind is only retired once a record
+// has made it into the new one.
+static uint8_t log_append(uint8_t cleared) {
+    ml_adaptation_record_t record __attribute__((aligned(4)));
+
+    if (log_state.next_free >= ML_ADAPT_LOG_RECORDS) {
+        log_state.active ^= 1;
+        log_state.next_free = 0;
+        log_state.spare = LOG_SPARE_STALE;
+    }
+
+    // The weights as they are now, a later label's included
+    ml_pipeline_lock();
+    memset(&record, 0, sizeof(record));
+    record.magic = ML_ADAPT_RECORD_MAGIC;
+    record.version = version + 1;
+    record.base_crc = base_crc;
+    record.cleared = cleared;
+    memcpy(record.output_weights, adapted_weights(), sizeof(record.output_weights));
+    memcpy(record.output_bias, adapted_bias(), sizeof(record.output_bias));
+    ml_pipeline_unlock();
+    record.crc = crc32_compute(&record, offsetof(ml_adaptation_record_t, crc));
+
+    const uint8_t *words = (const uint8_t *)&record;
+    uint32_t address = (uint32_t)log_record(log_state.active, log_state.next_free);
+    log_state.next_free++;
+    for (uint32_t at = 0; at < sizeof(record); at += FLASH_WRITE_WORD) {
+        if (!flash_write_word(address + at, &words[at])) {
+            return 0;
+        }
+    }
+
+    if (log_state.spare == LOG_SPARE_STALE) {
+        log_state.spare = LOG_SPARE_DIRTY;
+    }
+    version = record.version;
+    records_written++;
+    return 1;
+}
+
+static ml_adaptation_status_t log_request(uint8_t cleared) {
+    log_state.pending = 1;
+    log_state.pending_cleared = cleared;
+    return ml_adaptation_result(ML_ADAPT_STATUS_OK);
+}
+
+// Adapted weights are only trusted after a reset they cannot have caused:
+// a power cycle, a cold start or a commanded reset
+static uint8_t boot_safe(void) {
+    const crash_context_t *boot = crash_context_get_boot_report();
+
+    if (!boot->valid_on_boot || boot->reason == CRASH_REASON_RESET_REQUEST) {
+        return 1;
+    }
+    return boot->reason == CRASH_REASON_NONE &&
+           (boot->reset_flags & (RCC_RSR_PORRSTF | RCC_RSR_BORRSTF)) != 0;
+}
+
+// Under ml_pipeline_lock. Largest change from the base, and the output the
+// self test expects for the normal-class anchor from now on.
+static void bind_adapted(void) {
+    const float *base_w = (const float *)&base_weights[FAULT_MODEL_OUTPUT_WEIGHTS_AT];
+    const float *base_b = (const float *)&base_weights[FAULT_MODEL_OUTPUT_BIAS_AT];
+    float delta = 0.0f;
+
+    for (int i = 0; i < ML_ADAPT_OUTPUT_WEIGHTS + FAULT_MODEL_OUTPUTS; i++) {
+        float d = (i < ML_ADAPT_OUTPUT_WEIGHTS) ? adapted_weights()[i] - base_w[i] :
+                  adapted_bias()[i - ML_ADAPT_OUTPUT_WEIGHTS] - base_b[i - ML_ADAPT_OUTPUT_WEIGHTS];
+        if (d < 0.0f) {
+            d = -d;
+        }
+        if (d > delta) {
+            delta = d;
+        }
+    }
+    max_delta = delta;
+
+    if (ml_model_load_weights(live_model, adapted) &&
+        ml_model_evaluate(live_model, ml_adaptation_anchors[0], golden_output)) {
+        state = ML_ADAPT_ADAPTED;
+    } else {
+        ml_model_load_weights(live_model, base_weights);
+        state = ML_ADAPT_BASE;
+    }
+}
+
+static float clamp_to_base(float value, float base) {
+    if (value > base + ML_ADAPT_MAX_DELTA) {
+        return base + ML_ADAPT_MAX_DELTA;
+    }
+    if (value < base - ML_ADAPT_MAX_DELTA) {
+        return base - ML_ADAPT_MAX_DELTA;
+    }
+    return value;
+}
+
+// One SGD step of softmax cross-entropy on gemm_2. The hidden layers come
+// from the fused kernel, which holds the same hidden weights as the base.
+static void sgd_step(const float *input, uint8_t label) {
+    const float *base_w = (const float *)&base_weights[FAULT_MODEL_OUTPUT_WEIGHTS_AT];
+    const float *base_b = (const float *)&base_weights[FAULT_MODEL_OUTPUT_BIAS_AT];
+    float *weights = adapted_weights();
+    float *bias = adapted_bias();
+    float hidden[FAULT_MODEL_HIDDEN2];
+    float error[FAULT_MODEL_OUTPUTS];
+
+    fault_model_kernel_features(input, hidden);
+
+    for (int o = 0; o < FAULT_MODEL_OUTPUTS; o++) {
+        float acc = bias[o];
+        for (int i = 0; i < FAULT_MODEL_HIDDEN2; i++) {
+            acc += weights[o * FAULT_MODEL_HIDDEN2 + i] * hidden[i];
+        }
+        error[o] = acc;
+    }
+    fault_model_softmax(error);
+    error[label] -= 1.0f;
+
+    for (int o = 0; o < FAULT_MODEL_OUTPUTS; o++) {
+        float step = ML_ADAPT_LEARNING_RATE * error[o];
+        for (int i = 0; i < FAULT_MODEL_HIDDEN2; i++) {
+            int at = o * FAULT_MODEL_HIDDEN2 + i;
+            weights[at] = clamp_to_base(weights[at] - step * hidden[i], base_w[at]);
+        }
+        bias[o] = clamp_to_base(bias[o] - step, base_b[o]);
+    }
+}
+
+// Called by model_update under ml_pipeline_lock whenever the base weights
+// are (re)bound, at boot and after every slot change
+void ml_adaptation_attach(ml_model_t *model, const uint8_t *base) {
+    if (!ML_ADAPTATION) {
+        return;
+    }
+
+    live_model = model;
+    base_weights = base;
+    base_crc = crc32_compute(base, FAULT_MODEL_WEIGHTS_SIZE);
+    memcpy(adapted, base, FAULT_MODEL_WEIGHTS_SIZE);
+    state = ML_ADAPT_BASE;
+
+    const ml_adaptation_record_t *latest = log_latest(NULL, NULL);
+    version = (latest != NULL) ? latest->version : 0;
+    if (latest == NULL || latest->cleared || latest->base_crc != base_crc) {
+        return;
+    }
+
+    memcpy(adapted_weights(), latest->output_weights, sizeof(latest->output_weights));
+    memcpy(adapted_bias(), latest->output_bias, sizeof(latest->output_bias));
+
+    if (!boot_checked) {
+        boot_checked = 1;
+        if (!boot_safe()) {
+            state = ML_ADAPT_HELD;
+            return;
+        }
+    }
+    bind_adapted();
+}
+
+// Raised faults, for the ground to label by id. input is the feature
+// engine's, in raw units; the replay and the anchors are standardised.
+void ml_adaptation_note_fault(const float *input, const ml_result_t *result) {
+    float standardised[FAULT_MODEL_INPUTS];
+
+    if (!ML_ADAPTATION) {
+        return;
+    }
+
+    feature_engine_standardise(input, standardised);
+
+    taskENTER_CRITICAL();
+    ml_adaptation_event_t *event = &events[next_event];
+    next_event = (uint8_t)((next_event + 1) % ML_ADAPT_EVENTS);
+
+    if (++last_event_id == 0) {
+        last_event_id = 1;
+    }
+    event->id = last_event_id;
+    event->predicted_class = result->predicted_class;
+    event->confidence_pct = (uint8_t)(result->confidence * 100.0f);
+    event->labelled = 0;
+    memcpy(event->input, standardised, sizeof(event->input));
+    taskEXIT_CRITICAL();
+}
+
+// [u16 LE event id][true class]: the predicted class confirms the fault,
+// any other corrects it (0 = it was nominal)
+ml_adaptation_status_t ml_adaptation_label(const uint8_t *payload, uint8_t length) {
+    float input[FAULT_MODEL_INPUTS];
+    uint8_t predicted = 0;
+    uint8_t found = 0;
+
+    if (!ML_ADAPTATION || live_model == NULL) {
+        return ml_adaptation_result(ML_ADAPT_STATUS_DISABLED);
+    }
+    if (length != ML_ADAPT_LABEL_SIZE || payload[2] >= FAULT_MODEL_OUTPUTS) {
+        return ml_adaptation_result(ML_ADAPT_STATUS_BAD_LENGTH);
+    }
+    if (state == ML_ADAPT_HELD) {
+        return ml_adaptation_result(ML_ADAPT_STATUS_HELD);
+    }
+
+    uint16_t id = (uint16_t)(payload[0] | (payload[1] << 8));
+    uint8_t label = payload[2];
+
+    taskENTER_CRITICAL();
+    for (int i = 0; i < ML_ADAPT_EVENTS; i++) {
+        if (events[i].id == id && id != 0 && !events[i].labelled) {
+            events[i].labelled = 1;
+            predicted = events[i].predicted_class;
+            memcpy(input, events[i].input, sizeof(input));
+            found = 1;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (!found) {
+        return ml_adaptation_result(ML_ADAPT_STATUS_UNKNOWN_EVENT);
+    }
+
+    if (label == predicted) {
+        labels_confirmed++;
+    } else {
+        labels_corrected++;
+    }
+
+    memcpy(replay[label][replay_next[label]], input, sizeof(input));
+    replay_next[label] = (uint8_t)((replay_next[label] + 1) % ML_ADAPT_REPLAY_PER_CLASS);
+    if (replay_count[label] < ML_ADAPT_REPLAY_PER_CLASS) {
+        replay_count[label]++;
+    }
+
+    // Anchors first, then each class's replay oldest first - the order
+    // adaptation.py simulates
+    ml_pipeline_lock();
+    for (int epoch = 0; epoch < ML_ADAPT_EPOCHS; epoch++) {
+        for (uint8_t c = 0; c < FAULT_MODEL_OUTPUTS; c++) {
+            sgd_step(ml_adaptation_anchors[c], c);
+        }
+        for (uint8_t c = 0; c < FAULT_MODEL_OUTPUTS; c++) {
+            for (int k = 0; k < replay_count[c]; k++) {
+                int at = (replay_next[c] + ML_ADAPT_REPLAY_PER_CLASS - replay_count[c] + k) %
+                         ML_ADAPT_REPLAY_PER_CLASS;
+                sgd_step(replay[c][at], c);
+            }
+        }
+    }
+    bind_adapted();
+    ml_pipeline_unlock();
+
+    return log_request(0);
+}
+
+// [action]: ML_ADAPT_CONTROL_RESET drops the adaptation and the replay and
+// persists that; ML_ADAPT_CONTROL_RESUME loads an adaptation held back
+// after an unsafe reset
+ml_adaptation_status_t ml_adaptation_control(const uint8_t *payload, uint8_t length) {
+    if (!ML_ADAPTATION || live_model == NULL) {
+        return ml_adaptation_result(ML_ADAPT_STATUS_DISABLED);
+    }
+    if (length != 1 || payload[0] > ML_ADAPT_CONTROL_RESUME) {
+        return ml_adaptation_result(ML_ADAPT_STATUS_BAD_LENGTH);
+    }
+
+    if (payload[0] == ML_ADAPT_CONTROL_RESUME) {
+        if (state == ML_ADAPT_HELD) {
+            ml_pipeline_lock();
+            bind_adapted();
+            ml_pipeline_unlock();
+        }
+        return ml_adaptation_result(ML_ADAPT_STATUS_OK);
+    }
+
+    ml_pipeline_lock();
+    memcpy(adapted, base_weights, FAULT_MODEL_WEIGHTS_SIZE);
+    ml_model_load_weights(live_model, base_weights);
+    state = ML_ADAPT_BASE;
+    max_delta = 0.0f;
+    ml_pipeline_unlock();
+
+    memset(replay_count, 0, sizeof(replay_count));
+    memset(replay_next, 0, sizeof(replay_next));
+
+    return log_request(1);
+}
+
+// From ttc_monitor_task's loop. A requested record is written first,
+// unless the log is waiting for its spare sector; otherwise the spare is
+// checked and erased ahead of need, so an append never erases in line.
+void ml_adaptation_service(void) {
+    if (!ML_ADAPTATION) {
+        return;
+    }
+
+    if (!log_state.located) {
+        log_latest(&log_state.active, &log_state.next_free);
+        log_state.spare = LOG_SPARE_UNKNOWN;
+        log_state.located = 1;
+    }
+
+    uint8_t full = log_state.next_free >= ML_ADAPT_LOG_RECORDS;
+    if (log_state.pending && (!full || log_state.spare == LOG_SPARE_BLANK)) {
+        log_state.pending = 0;
+        if (!log_append(log_state.pending_cleared)) {
+            ml_adaptation_result(ML_ADAPT_STATUS_FLASH_ERROR);
+        }
+        return;
+    }
+
+    uint8_t spare = (uint8_t)(log_state.active ^ 1);
+    if (log_state.spare == LOG_SPARE_UNKNOWN) {
+        log_state.spare = sector_blank(spare) ? LOG_SPARE_BLANK : LOG_SPARE_DIRTY;
+    } else if (log_state.spare == LOG_SPARE_DIRTY) {
+        if (flash_write_erase(FLASH_WRITE_ADAPTATION_SECTOR + spare)) {
+            log_state.spare = LOG_SPARE_BLANK;
+        } else {
+            log_state.spare = LOG_SPARE_FAILED;
+            ml_adaptation_result(ML_ADAPT_STATUS_FLASH_ERROR);
+        }
+    }
+}
+
+// The normal-class anchor and its output as of the last update, in place
+// of the base weights' golden pair. Under ml_pipeline_lock.
+void ml_adaptation_golden(const float **input, const float **output) {
+    if (state != ML_ADAPT_ADAPTED) {
+        return;
+    }
+
+    *input = ml_adaptation_anchors[0];
+    *output = golden_output;
+}
+
+uint16_t ml_adaptation_build_report(uint8_t *buffer, uint16_t size) {
+    ml_adaptation_event_t snapshot[ML_ADAPT_EVENTS];
+    uint8_t unlabelled = 0;
+
+    if (size < ML_ADAPT_REPORT_SIZE) {
+        return 0;
+    }
+
+    taskENTER_CRITICAL();
+    memcpy(snapshot, events, sizeof(snapshot));
+    taskEXIT_CRITICAL();
+
+    uint8_t *entry = &buffer[ML_ADAPT_REPORT_HEADER_SIZE];
+    for (int i = 0; i < ML_ADAPT_EVENTS; i++) {
+        if (snapshot[i].id != 0 && !snapshot[i].labelled) {
+            unlabelled++;
+        }
+        ttc_put_u16(&entry[0], snapshot[i].id);
+        entry[2] = snapshot[i].predicted_class | (snapshot[i].labelled ? 0x80 : 0);
+        entry[3] = snapshot[i].confidence_pct;
+        entry += ML_ADAPT_REPORT_ENTRY_SIZE;
+    }
+
+    buffer[0] = (uint8_t)last_status;
+    buffer[1] = (uint8_t)state;
+    buffer[2] = unlabelled;
+    buffer[3] = 0;
+    ttc_put_u32(&buffer[4], version);
+    ttc_put_u32(&buffer[8], labels_confirmed);
+    ttc_put_u32(&buffer[12], labels_corrected);
+    ttc_put_u32(&buffer[16], records_written);
+    ttc_put_u32(&buffer[20], (uint32_t)(max_delta * 1000.0f));
+
+    return ML_ADAPT_REPORT_SIZE;
+}
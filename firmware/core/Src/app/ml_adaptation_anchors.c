@@ -0,0 +1,11 @@
+// Generated by cubesat-fault-predictor/adaptation.py - do not edit,
+// rerun it after retraining
+#include "ml_adaptation.h"
+
+const float ml_adaptation_anchors[FAULT_MODEL_OUTPUTS][FAULT_MODEL_INPUTS] = {
+    {1.5814434e-01f, -1.8244913e-01f, -1.7788856e-01f, -7.8943847e-03f, 2.2941579e-01f, 2.2871639e-01f, -2.1334085e-01f, -2.2941573e-01f},
+    {1.3192886e-01f, -1.3756426e-01f, -1.3275512e-01f, -4.1905180e-02f, -4.3588986e+00f, 2.3150443e-01f, -2.0346811e-01f, -2.2941573e-01f},
+    {-3.0267165e+00f, 3.4110382e+00f, 3.3213654e+00f, 3.2580469e-02f, 2.2941579e-01f, 2.3103239e-01f, -2.0167308e-01f, -2.2941573e-01f},
+    {2.0124312e-01f, -1.7098555e-01f, -1.6399398e-01f, 5.3702891e-02f, 2.2941579e-01f, -4.3497291e+00f, -1.9628794e-01f, 4.3588986e+00f},
+    {1.6316092e-01f, -1.8329626e-01f, -1.7839622e-01f, 8.1931993e-02f, 2.2941579e-01f, 2.2772804e-01f, 4.0148826e+00f, -2.2941573e-01f},
+};
@@ -0,0 +1,225 @@
+#include "ml_cache.h"
+#include "ml_integration.h"
+#include "fast_rules.h"
+#include "cycle_counter.h"
+#include "memory_map.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+// Quantised values are kept well inside int32_t; anything beyond, or NaN,
+// is never cached
+#define ML_CACHE_KEY_LIMIT 1.0e9f
+
+_Static_assert((ML_CACHE_ENTRIES & (ML_CACHE_ENTRIES - 1)) == 0, "ML_CACHE_ENTRIES must be a power of two");
+
+#if ML_INFERENCE_CACHE
+typedef struct {
+    int32_t key[FEATURE_MODEL_INPUTS];  // Compared in full, the hash only picks the slot
+    float output[ML_OUTPUT_SIZE];
+    uint32_t classifier_cycles;         // What computing output cost
+    uint8_t valid;
+} ml_cache_entry_t;
+
+// Channel each network input is a statistic of. Windowed statistics are
+// keyed at the resolution of their channel too.
+static const uint8_t input_channel[FEATURE_MODEL_INPUTS] = {
+#define ML_CACHE_INPUT_CHANNEL(channel, stat, mean, scale) FEATURE_CHANNEL_##channel,
+    FEATURE_SCHEMA_MODEL_INPUTS(ML_CACHE_INPUT_CHANNEL)
+#undef ML_CACHE_INPUT_CHANNEL
+};
+
+static const float channel_resolution[FEATURE_CHANNEL_COUNT] = {
+#define ML_CACHE_RESOLUTION(name, window, level, resolution) resolution,
+    FEATURE_SCHEMA_CHANNELS(ML_CACHE_RESOLUTION)
+#undef ML_CACHE_RESOLUTION
+};
+
+// The fast_rules classes as the network sees them, the sample tests of
+// cubesat-fault-predictor/fast_rules.py. A latest sample on the fault
+// side of any of these always goes to the classifier.
+static const struct {
+    uint8_t channel;
+    uint8_t fault_above;            // Fault at or above the threshold, else below it
+    float threshold;
+} rule_thresholds[] = {
+    {FEATURE_CHANNEL_HEARTBEAT_SIGNAL, 0, 0.5f},
+    {FEATURE_CHANNEL_UART_TIMEOUT, 1, 0.5f},
+    {FEATURE_CHANNEL_CRC_ERROR_COUNT, 1, (float)FAST_RULE_CORRUPTION_ERRORS},
+};
+
+// Only ml_inference_task touches the table, under the pipeline lock
+static ml_cache_entry_t entries[ML_CACHE_ENTRIES] DTCM_BSS;
+static float inv_resolution[FEATURE_MODEL_INPUTS] DTCM_BSS;
+
+// Key and slot of the last miss, for ml_cache_store
+static struct {
+    int32_t key[FEATURE_MODEL_INPUTS];
+    uint8_t slot;
+    uint8_t valid;
+} pending DTCM_BSS;
+#endif
+
+static ml_cache_stats_t stats;
+
+void ml_cache_init(void) {
+#if ML_INFERENCE_CACHE
+    memset(entries, 0, sizeof(entries));
+    memset(&pending, 0, sizeof(pending));
+    for (int i = 0; i < FEATURE_MODEL_INPUTS; i++) {
+        inv_resolution[i] = 1.0f / channel_resolution[input_channel[i]];
+    }
+#endif
+    memset(&stats, 0, sizeof(stats));
+}
+
+#if ML_INFERENCE_CACHE
+static uint8_t ml_cache_bypass(void) {
+    for (unsigned i = 0; i < sizeof(rule_thresholds) / sizeof(rule_thresholds[0]); i++) {
+        float value = feature_engine_stat((feature_channel_t)rule_thresholds[i].channel,
+                                          FEATURE_STAT_VALUE);
+        uint8_t above = (value >= rule_thresholds[i].threshold);
+
+        if (above == rule_thresholds[i].fault_above) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Quantise to sensor resolution and hash, FNV-1a over the key words
+static uint8_t ml_cache_key(const float *features, int32_t *key, uint8_t *slot) {
+    uint32_t hash = 2166136261U;
+
+    for (int i = 0; i < FEATURE_MODEL_INPUTS; i++) {
+        float steps = features[i] * inv_resolution[i];
+
+        if (!(steps > -ML_CACHE_KEY_LIMIT && steps < ML_CACHE_KEY_LIMIT)) {
+            return 0;
+        }
+        key[i] = (int32_t)(steps + ((steps >= 0.0f) ? 0.5f : -0.5f));
+
+        hash ^= (uint32_t)key[i];
+        hash *= 16777619U;
+    }
+
+    *slot = (uint8_t)((hash ^ (hash >> 16)) & (ML_CACHE_ENTRIES - 1));
+    return 1;
+}
+#endif
+
+// The stored output for features if there is one, copied to output.
+// Otherwise remembers where the result belongs for ml_cache_store.
+ITCM_FUNC uint8_t ml_cache_lookup(const float *features, float *output) {
+#if ML_INFERENCE_CACHE
+    uint32_t start = cycle_counter_now();
+    const ml_cache_entry_t *entry = NULL;
+    uint8_t bypass = ml_cache_bypass();
+
+    pending.valid = 0;
+    if (!bypass && ml_cache_key(features, pending.key, &pending.slot)) {
+        entry = &entries[pending.slot];
+        if (entry->valid && memcmp(entry->key, pending.key, sizeof(pending.key)) == 0) {
+            memcpy(output, entry->output, sizeof(entry->output));
+        } else {
+            entry = NULL;
+            pending.valid = 1;
+        }
+    }
+    uint32_t cycles = cycle_counter_now() - start;
+
+    taskENTER_CRITICAL();
+    stats.lookups++;
+    stats.lookup_cycles += cycles;
+    if (bypass) {
+        stats.bypasses++;
+    } else if (entry != NULL) {
+        stats.hits++;
+        stats.saved_cycles += entry->classifier_cycles;
+    }
+    taskEXIT_CRITICAL();
+
+    return entry != NULL;
+#else
+    (void)features;
+    (void)output;
+    return 0;
+#endif
+}
+
+// After a miss: keep the classifier's output, unless the decision was too
+// close to ML_DECISION_CONFIDENCE for a step of input to be sure of it
+void ml_cache_store(const float *output, const ml_result_t *result, uint32_t classifier_cycles) {
+#if ML_INFERENCE_CACHE
+    if (!pending.valid || result->confidence <= ML_DECISION_CONFIDENCE) {
+        pending.valid = 0;
+        return;
+    }
+
+    ml_cache_entry_t *entry = &entries[pending.slot];
+    memcpy(entry->key, pending.key, sizeof(entry->key));
+    memcpy(entry->output, output, sizeof(entry->output));
+    entry->classifier_cycles = classifier_cycles;
+    entry->valid = 1;
+    pending.valid = 0;
+
+    taskENTER_CRITICAL();
+    stats.stores++;
+    taskEXIT_CRITICAL();
+#else
+    (void)output;
+    (void)result;
+    (void)classifier_cycles;
+#endif
+}
+
+// Every entry belongs to the weights that computed it
+void ml_cache_invalidate(void) {
+#if ML_INFERENCE_CACHE
+    for (int i = 0; i < ML_CACHE_ENTRIES; i++) {
+        entries[i].valid = 0;
+    }
+    pending.valid = 0;
+#endif
+
+    taskENTER_CRITICAL();
+    stats.invalidations++;
+    taskEXIT_CRITICAL();
+}
+
+void ml_cache_get_stats(ml_cache_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t ml_cache_build_report(uint8_t *buffer, uint16_t size) {
+    ml_cache_stats_t snapshot;
+    uint32_t hit_rate = 0;
+    uint32_t lookup_avg = 0;
+    int32_t net_saving = 0;
+
+    if (size < ML_CACHE_REPORT_SIZE) {
+        return 0;
+    }
+
+    ml_cache_get_stats(&snapshot);
+
+    if (snapshot.lookups > 0) {
+        hit_rate = (uint32_t)((uint64_t)snapshot.hits * 10000 / snapshot.lookups);
+        lookup_avg = (uint32_t)(snapshot.lookup_cycles / snapshot.lookups);
+        net_saving = (int32_t)(((int64_t)snapshot.saved_cycles - (int64_t)snapshot.lookup_cycles) /
+                               (int64_t)snapshot.lookups);
+    }
+
+    ttc_put_u32(&buffer[0], snapshot.lookups);
+    ttc_put_u32(&buffer[4], snapshot.hits);
+    ttc_put_u32(&buffer[8], snapshot.bypasses);
+    ttc_put_u32(&buffer[12], snapshot.invalidations);
+    ttc_put_u32(&buffer[16], hit_rate);
+    ttc_put_u32(&buffer[20], lookup_avg);
+    ttc_put_u32(&buffer[24], (uint32_t)(snapshot.saved_cycles / 1000));
+    ttc_put_u32(&buffer[28], (uint32_t)net_saving);
+
+    return ML_CACHE_REPORT_SIZE;
+}
@@ -0,0 +1,149 @@
+#include "ml_cascade.h"
+#include "ml_integration.h"
+#include "memory_map.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+// Nominal operation as seen by the gate. Only ml_inference_task touches
+// it, under the pipeline lock.
+typedef struct {
+    float mean[ML_CASCADE_FEATURES];
+    float variance[ML_CASCADE_FEATURES];
+    float inv_variance[ML_CASCADE_FEATURES];
+    uint32_t learned;               // Confirmed normal samples seen
+    uint32_t since_classifier;      // Samples since the classifier last ran
+    uint8_t refresh;                // Last wake was warm-up or refresh
+} ml_cascade_gate_t;
+
+static ml_cascade_gate_t gate DTCM_BSS;
+static ml_cascade_stats_t stats;
+
+void ml_cascade_init(void) {
+    memset(&gate, 0, sizeof(gate));
+    memset(&stats, 0, sizeof(stats));
+}
+
+// The gate itself: a handful of multiply-adds per feature, against the
+// few hundred MACs and five expf of the classifier
+ITCM_FUNC uint8_t ml_cascade_wake(const float *features) {
+    float score = 0.0f;
+
+    gate.refresh = (gate.learned < ML_CASCADE_WARMUP_SAMPLES ||
+                    gate.since_classifier + 1 >= ML_CASCADE_REFRESH_SAMPLES);
+    if (gate.refresh) {
+        return 1;
+    }
+
+    for (int i = 0; i < ML_CASCADE_FEATURES; i++) {
+        float d = features[i] - gate.mean[i];
+        float z2 = d * d * gate.inv_variance[i];
+
+        if (z2 > ML_CASCADE_WAKE_Z * ML_CASCADE_WAKE_Z) {
+            return 1;
+        }
+        score += z2;
+    }
+
+    return score > ML_CASCADE_WAKE_SCORE * ML_CASCADE_FEATURES;
+}
+
+// Samples the classifier confirmed as normal move the nominal statistics.
+// A cumulative average during warm-up, an EWMA afterwards.
+void ml_cascade_learn(const float *features, const ml_result_t *result) {
+    if (result->predicted_class != 0 || result->confidence <= ML_DECISION_CONFIDENCE) {
+        return;
+    }
+
+    float alpha = 1.0f / (float)(1U << ML_CASCADE_LEARN_SHIFT);
+    if (gate.learned < (1U << ML_CASCADE_LEARN_SHIFT)) {
+        alpha = 1.0f / (float)(gate.learned + 1);
+    }
+
+    for (int i = 0; i < ML_CASCADE_FEATURES; i++) {
+        float d = features[i] - gate.mean[i];
+
+        gate.mean[i] += alpha * d;
+        gate.variance[i] = (1.0f - alpha) * (gate.variance[i] + alpha * d * d);
+
+        float variance = gate.variance[i];
+        if (variance < ML_CASCADE_MIN_VARIANCE) {
+            variance = ML_CASCADE_MIN_VARIANCE;
+        }
+        gate.inv_variance[i] = 1.0f / variance;
+    }
+
+    gate.learned++;
+}
+
+void ml_cascade_note(uint8_t classifier_ran, uint32_t novelty_cycles, uint32_t gate_cycles,
+                     uint32_t classifier_cycles) {
+    if (classifier_ran) {
+        gate.since_classifier = 0;
+    } else {
+        gate.since_classifier++;
+    }
+
+    taskENTER_CRITICAL();
+    stats.samples++;
+    stats.novelty_cycles += novelty_cycles;
+    stats.gate_cycles += gate_cycles;
+    if (classifier_ran) {
+        stats.classifier_runs++;
+        stats.classifier_cycles += classifier_cycles;
+        if (gate.refresh) {
+            stats.refresh_runs++;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+void ml_cascade_get_stats(ml_cascade_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t ml_cascade_build_report(uint8_t *buffer, uint16_t size) {
+    ml_cascade_stats_t snapshot;
+    uint32_t novelty_avg = 0;
+    uint32_t gate_avg = 0;
+    uint32_t classifier_avg = 0;
+    uint32_t sample_avg = 0;
+    int32_t saving = 0;
+
+    if (size < ML_CASCADE_REPORT_SIZE) {
+        return 0;
+    }
+
+    ml_cascade_get_stats(&snapshot);
+
+    if (snapshot.samples > 0) {
+        uint64_t total = snapshot.novelty_cycles + snapshot.gate_cycles + snapshot.classifier_cycles;
+
+        novelty_avg = (uint32_t)(snapshot.novelty_cycles / snapshot.samples);
+        gate_avg = (uint32_t)(snapshot.gate_cycles / snapshot.samples);
+        sample_avg = (uint32_t)(total / snapshot.samples);
+
+        if (snapshot.classifier_runs > 0) {
+            classifier_avg = (uint32_t)(snapshot.classifier_cycles / snapshot.classifier_runs);
+
+            // Against the classifier alone on every sample
+            uint64_t always = (uint64_t)classifier_avg * snapshot.samples;
+            if (always > 0) {
+                saving = (int32_t)(10000 - (int64_t)(total * 10000 / always));
+            }
+        }
+    }
+
+    ttc_put_u32(&buffer[0], snapshot.samples);
+    ttc_put_u32(&buffer[4], snapshot.classifier_runs);
+    ttc_put_u32(&buffer[8], snapshot.refresh_runs);
+    ttc_put_u32(&buffer[12], gate_avg);
+    ttc_put_u32(&buffer[16], classifier_avg);
+    ttc_put_u32(&buffer[20], sample_avg);
+    ttc_put_u32(&buffer[24], (uint32_t)saving);
+    ttc_put_u32(&buffer[28], novelty_avg);
+
+    return ML_CASCADE_REPORT_SIZE;
+}
@@ -1,118 +1,401 @@
 #include "ml_integration.h"
 #include "network.h"
 #include "network_data.h"
+#include "app_x-cube-ai.h"
 #include "sensor_manager.h"
 #include "heartbeat_monitor.h"
+#include "runtime_stats.h"
+#include "memory_map.h"
+#include "perf_bench.h"
+#include "cycle_counter.h"
+#include "fault_model_kernel.h"
+#include "ml_cascade.h"
+#include "novelty_monitor.h"
+#include "model_update.h"
+#include "feature_engine.h"
+#include "ml_cache.h"
+#include "fast_rules.h"
+#include "ttc_communication.h"
+#include "bist.h"
+#include "crc32.h"
 #include <string.h>
+#include <math.h>
 
-static ai_error ai_error_code;
+static ai_error ai_last_error;
 
+// The classifier goes through the ai_mnetwork registry in app_x-cube-ai.c
+// like every other network. Its entry binds it to the registry's shared
+// activations pool, pool0, with the network's input and output buffers
+// in it (AI_NETWORK_INPUTS_IN_ACTIVATIONS); the linker scripts put pool0
+// in DTCM, zero wait states and outside the data cache. Networks only run
+// one at a time under the pipeline lock. The weights are used where they
+// are, flash for the linked-in blob and the update slots.
+static ml_model_info_t model_info;
+
+_Static_assert(AI_NETWORK_DATA_ACTIVATIONS_COUNT == 1 && AI_NETWORK_DATA_WEIGHTS_COUNT == 1,
+               "one activations pool and one weights blob expected");
+_Static_assert(AI_NETWORK_OUT_1_SIZE == BIST_GOLDEN_OUTPUT_SIZE &&
+               AI_NETWORK_IN_1_SIZE == BIST_GOLDEN_INPUT_SIZE,
+               "golden pair does not match the network");
+
+_Static_assert(FEATURE_MODEL_INPUTS == AI_NETWORK_IN_1_SIZE,
+               "feature_schema.h does not match the network's input");
+
+// The dataset's packet and CRC error counts are per one-second sample
+// window, the window fast_rules counts corruption errors over too
+#define ML_COUNTER_WINDOW_SAMPLES (FAST_RULE_CORRUPTION_WINDOW_MS / FEATURE_SAMPLE_PERIOD_MS)
+
+// Packets read 100 per window on a link at TTC_UPLINK_NOMINAL_FRAMES_PER_S,
+// as a nominal link does in the dataset (95..99)
+#define ML_PACKETS_PER_FRAME \
+    (100.0f * 1000.0f / ((float)TTC_UPLINK_NOMINAL_FRAMES_PER_S * FAST_RULE_CORRUPTION_WINDOW_MS))
+
+_Static_assert(ML_COUNTER_WINDOW_SAMPLES >= 1 && ML_COUNTER_WINDOW_SAMPLES <= 255,
+               "counter window must be 1..255 samples");
+
+// Cumulative counts at the last ML_COUNTER_WINDOW_SAMPLES samples, the
+// oldest at head
+static struct {
+    uint32_t frames[ML_COUNTER_WINDOW_SAMPLES];
+    uint32_t corruption_errors[ML_COUNTER_WINDOW_SAMPLES];
+    uint8_t head;
+    uint8_t samples;
+} counter_history;
+
+static void ml_counters_init(void) {
+    fast_rules_stats_t rules;
+    uint32_t frames = ttc_frames_received();
+
+    fast_rules_get_stats(&rules);
+    for (int i = 0; i < ML_COUNTER_WINDOW_SAMPLES; i++) {
+        counter_history.frames[i] = frames;
+        counter_history.corruption_errors[i] = rules.corruption_errors;
+    }
+    counter_history.head = 0;
+    counter_history.samples = 0;
+}
+
+// One owner at a time for the network and the ADC it samples from:
+// ml_inference_task, or the self test on boot or on command
+static osMutexId_t ml_pipeline_mutex = NULL;
+static StaticSemaphore_t ml_pipeline_mutex_cb DTCM_BSS;
+
+static const osMutexAttr_t ml_pipeline_mutex_attributes = {
+    .name = "MLPipeline",
+    .attr_bits = osMutexPrioInherit,
+    .cb_mem = &ml_pipeline_mutex_cb,
+    .cb_size = sizeof(StaticSemaphore_t),
+};
+
+void ml_integration_init(void) {
+    ml_pipeline_mutex = osMutexNew(&ml_pipeline_mutex_attributes);
+    if (ml_pipeline_mutex == NULL) {
+        Error_Handler();
+    }
+}
+
+void ml_pipeline_lock(void) {
+    osMutexAcquire(ml_pipeline_mutex, osWaitForever);
+}
+
+void ml_pipeline_unlock(void) {
+    osMutexRelease(ml_pipeline_mutex);
+}
+
+// Where the runtime was bound, from its own report
+static uint8_t ml_model_note_report(ml_model_t *model, const uint8_t *weights) {
+    ai_network_report report;
+
+    if (!ai_mnetwork_get_report(model->network, &report)) {
+        ai_last_error = ai_mnetwork_get_error(model->network);
+        return 0;
+    }
+
+    const ai_buffer *pool = AI_BUFFER_ARRAY_ITEM(&report.map_activations, 0);
+    const ai_buffer *blob = AI_BUFFER_ARRAY_ITEM(&report.map_weights, 0);
+
+    model_info.macc = (uint32_t)report.n_macc;
+    model_info.nodes = report.n_nodes;
+    model_info.signature = report.signature;
+    model_info.activations_size = (pool != NULL) ? pool->size : 0;
+    model_info.weights_size = (blob != NULL) ? blob->size : 0;
+    model_info.activations_address = (pool != NULL) ? (uint32_t)(uintptr_t)pool->data : 0;
+    model_info.weights_address = (uint32_t)(uintptr_t)weights;
+    model_info.weights_crc = crc32_compute(weights, model_info.weights_size);
+
+    return report.n_inputs == 1 && report.n_outputs == 1 &&
+           AI_BUFFER_SIZE(&report.inputs[0]) == AI_NETWORK_IN_1_SIZE &&
+           AI_BUFFER_SIZE(&report.outputs[0]) == AI_NETWORK_OUT_1_SIZE &&
+           model_info.activations_size <= AI_MNETWORK_DATA_ACTIVATIONS_INT_SIZE &&
+           model_info.weights_size == AI_NETWORK_DATA_WEIGHTS_SIZE;
+}
+
+// The X-CUBE-AI runtime alone, whichever kernel inference uses
+static uint8_t ml_model_run_network(ml_model_t *model, const float *input, float *output) {
+    memcpy(model->ai_input->data, input, AI_NETWORK_IN_1_SIZE * sizeof(float));
+
+    if (ai_mnetwork_run(model->network, model->ai_input, model->ai_output) != 1) {
+        ai_last_error = ai_mnetwork_get_error(model->network);
+        return 0;
+    }
+
+    memcpy(output, model->ai_output->data, AI_NETWORK_OUT_1_SIZE * sizeof(float));
+    return 1;
+}
+
+// The self test's golden pair through the freshly bound runtime, before
+// anything else touches the weights
+static uint8_t ml_model_check_golden(ml_model_t *model) {
+    const float *input;
+    const float *expected;
+    float output[AI_NETWORK_OUT_1_SIZE];
+
+    bist_golden_vector(&input, &expected);
+
+    uint32_t start = cycle_counter_now();
+    uint8_t ran = ml_model_run_network(model, input, output);
+    model_info.golden_us = CYCLES_TO_US(cycle_counter_now() - start);
+    if (!ran) {
+        return 0;
+    }
+
+    float worst = bist_golden_error(output, expected);
+    model_info.golden_error = (uint32_t)(worst * 1000000.0f);
+    return worst <= BIST_GOLDEN_TOLERANCE;
+}
+
+// Create the network and bind it in one go, through its registry entry's
+// ai_network_create_and_init, to the shared pool and the linked-in
+// weights, then check it reports the shapes this image was built for and
+// reproduces the golden pair
 uint8_t ml_model_init(ml_model_t *model) {
-    ai_error_code = ai_system_init();
-    if (ai_error_code != AI_ERROR_NONE) {
+    const ai_handle weights[AI_NETWORK_DATA_WEIGHTS_COUNT] = {
+        (ai_handle)ml_model_factory_weights(),
+    };
+
+    taskENTER_CRITICAL();
+    memset(&model_info, 0, sizeof(model_info));
+    taskEXIT_CRITICAL();
+    model->network = AI_HANDLE_NULL;
+
+    uint32_t start = cycle_counter_now();
+    ai_last_error = ai_mnetwork_create_and_init(AI_NETWORK_MODEL_NAME, &model->network, weights);
+    model_info.init_us = CYCLES_TO_US(cycle_counter_now() - start);
+    model_info.error = ai_last_error;
+
+    if (ai_last_error.type != AI_ERROR_NONE) {
+        model_info.status = ML_MODEL_CREATE_FAILED;
         return 0;
     }
-    
-    ai_error_code = ai_network_create(&model->network, AI_NETWORK_DATA_CONFIG);
-    if (ai_error_code != AI_ERROR_NONE) {
+
+    model->ai_input = ai_mnetwork_inputs_get(model->network, NULL);
+    model->ai_output = ai_mnetwork_outputs_get(model->network, NULL);
+    if (model->ai_input == NULL || model->ai_output == NULL ||
+        !ml_model_note_report(model, ml_model_factory_weights())) {
+        model_info.status = ML_MODEL_SHAPE_MISMATCH;
         return 0;
     }
-    
-    model->ai_input = ai_network_inputs_get(model->network, NULL);
-    model->ai_output = ai_network_outputs_get(model->network, NULL);
-    
+
+    if (!ml_model_check_golden(model)) {
+        model_info.status = ML_MODEL_GOLDEN_FAILED;
+        return 0;
+    }
+    model_info.status = ML_MODEL_LOADED;
+
+    feature_engine_init();
+    ml_counters_init();
+    ml_cache_init();
+    ml_cascade_init();
+    novelty_monitor_init();
+
+    // Uploaded weights replace the linked-in ones if a slot holds a
+    // verified image; a bad one is retired and the next best tried. Any
+    // on-board adaptation is then layered on top.
+    model_update_init(model);
     return 1;
 }
 
-uint8_t ml_model_run_inference(ml_model_t *model, float *input_data, float *output_data) {
-    // Update sensor readings before inference
-    update_sensor_readings();
-    
-    // Prepare ML input features
-    collect_ml_input_data(input_data);
-    
-    // Copy input data to AI buffer
-    memcpy(model->ai_input->data, input_data, ML_INPUT_SIZE * sizeof(float));
-    
-    // Run inference
-    ai_error_code = ai_network_run(model->network, model->ai_input, model->ai_output);
-    if (ai_error_code != AI_ERROR_NONE) {
+// The weights blob linked into the image
+const uint8_t *ml_model_factory_weights(void) {
+    return (const uint8_t *)s_network_weights_array_u64;
+}
+
+// Rebind the network to another weights blob of the same topology, NULL
+// for the one linked into the image. Under ml_pipeline_lock.
+uint8_t ml_model_load_weights(ml_model_t *model, const uint8_t *weights) {
+    if (weights == NULL) {
+        weights = ml_model_factory_weights();
+    }
+
+    const ai_handle table[AI_NETWORK_DATA_WEIGHTS_COUNT] = {(ai_handle)weights};
+
+    // Whatever happens next, stored outputs no longer match the weights
+    ml_cache_invalidate();
+
+    uint32_t start = cycle_counter_now();
+    uint8_t bound = ai_mnetwork_init_weights(model->network, table);
+    uint32_t cycles = cycle_counter_now() - start;
+    if (!bound) {
+        ai_last_error = ai_mnetwork_get_error(model->network);
         return 0;
     }
-    
-    // Copy output data
-    memcpy(output_data, model->ai_output->data, ML_OUTPUT_SIZE * sizeof(float));
-    
+
+    uint32_t crc = crc32_compute(weights, AI_NETWORK_DATA_WEIGHTS_SIZE);
+    taskENTER_CRITICAL();
+    model_info.weights_address = (uint32_t)(uintptr_t)weights;
+    model_info.weights_crc = crc;
+    model_info.reloads++;
+    model_info.reload_us = CYCLES_TO_US(cycles);
+    taskEXIT_CRITICAL();
+
+    // The fused kernel keeps its own copy in DTCM
+    fault_model_kernel_load(weights);
     return 1;
 }
 
-void collect_ml_input_data(float *input) {
-    // Feature 0-2: Voltage readings
-    input[0] = read_voltage_3v3();
-    input[1] = read_voltage_5v();
-    input[2] = read_internal_vref();
-    
-    // Feature 3-5: Temperature and current
-    input[3] = read_cpu_temperature();
-    input[4] = read_current_consumption();
-    
-    // Feature 6-8: Heartbeat metrics
-    input[5] = (float)get_heartbeat_period_ms() / 1000.0f; // Convert to seconds
-    input[6] = is_heartbeat_healthy() ? 1.0f : 0.0f;
-    
-    // Feature 9-11: System load metrics (simplified)
-    input[7] = get_cpu_usage_percent() / 100.0f;  // Normalized to 0-1
-    input[8] = get_memory_usage_percent() / 100.0f; // Normalized to 0-1
-    
-    // Feature 12-14: Timing metrics
-    uint32_t current_tick = osKernelGetTickCount();
-    input[9] = (float)(current_tick % 10000) / 10000.0f; // System uptime pattern
-    
-    // Features 15-31: Additional system metrics and historical patterns
-    // These would be filled with more sophisticated monitoring
-    for(int i = 10; i < ML_INPUT_SIZE; i++) {
-        // Add noise or additional features based on your specific requirements
-        input[i] = 0.0f; 
+// One forward pass through whichever kernel this build selected, ending
+// at the logits when asked to and the kernel allows it. The features are
+// kept in input_buffer for perf_bench to compare the two kernels.
+static uint8_t ml_model_forward(ml_model_t *model, const float *input, float *output,
+                                uint8_t logits) {
+    memcpy(model->input_buffer, input, AI_NETWORK_IN_1_SIZE * sizeof(float));
+
+#if ML_FUSED_KERNEL
+    fault_model_kernel_logits(input, output);
+    if (!logits) {
+        fault_model_softmax(output);
+    }
+#else
+    (void)logits;
+    if (!ml_model_run_network(model, input, output)) {
+        return 0;
     }
+#endif
+    return 1;
 }
 
-// CPU usage calculation using FreeRTOS
-float get_cpu_usage_percent(void) {
-    static uint32_t last_idle_count = 0;
-    static uint32_t last_tick_count = 0;
-    
-    uint32_t current_idle_count = xTaskGetIdleTaskCount();
-    uint32_t current_tick_count = xTaskGetTickCount();
-    
-    uint32_t idle_ticks = current_idle_count - last_idle_count;
-    uint32_t total_ticks = current_tick_count - last_tick_count;
+// What the classifier is taken to have said when the gate let it sleep:
+// certainly normal, in the form ml_model_run_inference produces
+static void ml_model_nominal_output(float *output) {
+    for (int i = 0; i < ML_OUTPUT_SIZE; i++) {
+#if ML_SKIP_SOFTMAX
+        output[i] = (i == 0) ? 0.0f : -INFINITY;
+#else
+        output[i] = (i == 0) ? 1.0f : 0.0f;
+#endif
+    }
+}
+
+uint8_t ml_model_run_inference(ml_model_t *model, float *input_data, float *output_data,
+                               ml_output_origin_t *origin) {
+    ml_pipeline_lock();
+
+    // Update sensor readings before inference
+    update_sensor_readings();
     
-    last_idle_count = current_idle_count;
-    last_tick_count = current_tick_count;
+    // Prepare ML input features
+    collect_ml_input_data(input_data);
     
-    if (total_ticks > 0) {
-        float usage = 100.0f - ((float)idle_ticks * 100.0f / (float)total_ticks);
-        return usage > 0 ? usage : 0;
+    // First stage, on every sample: the novelty forest, then the gate.
+    // The classifier only runs for what the gate cannot explain as
+    // nominal, or what the novelty model has not seen before.
+    uint32_t start = cycle_counter_now();
+    uint8_t novel = novelty_monitor_sample(input_data);
+    uint32_t novelty_cycles = cycle_counter_now() - start;
+
+    start = cycle_counter_now();
+    uint8_t wake = ml_cascade_wake(input_data);
+    uint32_t gate_cycles = cycle_counter_now() - start;
+    uint32_t classifier_cycles = 0;
+    uint8_t ok = 1;
+
+    if (wake || novel) {
+        // Same quantised inputs as a recent confident decision: its output
+        // again. The cascade is charged for the lookup either way.
+        uint32_t forward_cycles = 0;
+        start = cycle_counter_now();
+        uint8_t cached = ml_cache_lookup(input_data, output_data);
+        *origin = cached ? ML_OUTPUT_CACHED : ML_OUTPUT_CLASSIFIER;
+        if (!cached) {
+            float standardised[AI_NETWORK_IN_1_SIZE];
+            uint32_t forward_start = cycle_counter_now();
+            feature_engine_standardise(input_data, standardised);
+            ok = ml_model_forward(model, standardised, output_data, ML_SKIP_SOFTMAX);
+            forward_cycles = cycle_counter_now() - forward_start;
+            perf_bench_note_inference(forward_cycles);
+        }
+        classifier_cycles = cycle_counter_now() - start;
+
+        if (ok) {
+            ml_result_t result = ml_model_decide(output_data);
+            if (!cached) {
+                ml_cache_store(output_data, &result, forward_cycles);
+            }
+            if (!novel) {
+                ml_cascade_learn(input_data, &result);
+            } else if (result.predicted_class == 0) {
+                // A fault without a label, or a gap in the training data
+                novelty_monitor_note_unexplained();
+            }
+        }
+    } else {
+        ml_model_nominal_output(output_data);
+        *origin = ML_OUTPUT_GATED;
     }
-    
-    return 25.0f; // Default low usage
+
+    ml_cascade_note(wake || novel, novelty_cycles, gate_cycles, classifier_cycles);
+
+    ml_pipeline_unlock();
+    return ok;
 }
 
-// Memory usage calculation
-float get_memory_usage_percent(void) {
-    // Get heap info from FreeRTOS
-    size_t free_heap = xPortGetFreeHeapSize();
-    size_t total_heap = configTOTAL_HEAP_SIZE;
-    
-    if (total_heap > 0) {
-        float usage = ((float)(total_heap - free_heap) / (float)total_heap) * 100.0f;
-        return usage;
+// One inference on caller-supplied standardised features, sized to the
+// network's own input and output, always as probabilities. The caller
+// holds the pipeline lock.
+uint8_t ml_model_evaluate(ml_model_t *model, const float *input, float *output) {
+    return ml_model_forward(model, input, output, 0);
+}
+
+// One sample of every schema channel into the feature engine, then the
+// network's inputs out of it, in raw units. Called once per inference
+// period.
+void collect_ml_input_data(float *input) {
+    float sample[FEATURE_CHANNEL_COUNT];
+    fast_rules_stats_t rules;
+
+    float voltage = read_voltage_5v();
+    float current = read_current_consumption();
+    uint32_t frames = ttc_frames_received();
+    fast_rules_get_stats(&rules);
+
+    // Counts since the oldest sample in the window. Until the window has
+    // filled that is the count at init, and packets are scaled to the
+    // time actually covered.
+    uint8_t head = counter_history.head;
+    uint32_t window_frames = frames - counter_history.frames[head];
+    uint32_t window_errors = rules.corruption_errors - counter_history.corruption_errors[head];
+    counter_history.frames[head] = frames;
+    counter_history.corruption_errors[head] = rules.corruption_errors;
+    counter_history.head = (uint8_t)((head + 1) % ML_COUNTER_WINDOW_SAMPLES);
+    if (counter_history.samples < ML_COUNTER_WINDOW_SAMPLES) {
+        counter_history.samples++;
     }
-    
-    return 50.0f; // Default
+    float covered = (float)counter_history.samples / (float)ML_COUNTER_WINDOW_SAMPLES;
+
+    sample[FEATURE_CHANNEL_BUS_VOLTAGE] = voltage;
+    sample[FEATURE_CHANNEL_CURRENT_DRAW] = current;
+    sample[FEATURE_CHANNEL_POWER_CONSUMPTION] = voltage * current;
+    sample[FEATURE_CHANNEL_MCU_CORE_TEMP] = read_cpu_temperature();
+    sample[FEATURE_CHANNEL_HEARTBEAT_SIGNAL] = is_heartbeat_healthy() ? 1.0f : 0.0f;
+    sample[FEATURE_CHANNEL_UART_PACKETS_RECEIVED] = (float)window_frames * ML_PACKETS_PER_FRAME / covered;
+    sample[FEATURE_CHANNEL_CRC_ERROR_COUNT] = (float)window_errors;
+    sample[FEATURE_CHANNEL_UART_TIMEOUT] = ttc_check_connection() ? 0.0f : 1.0f;
+
+    feature_engine_push(sample);
+    feature_engine_model_input(input, ML_INPUT_SIZE);
 }
 
-ml_result_t process_ml_output(float *output) {
+ITCM_FUNC ml_result_t process_ml_output(float *output) {
     ml_result_t result = {0};
     float max_confidence = 0.0f;
     
@@ -136,7 +419,102 @@ ml_result_t process_ml_output(float *output) {
     return result;
 }
 
+// Decision on what ml_model_run_inference produced. With ML_SKIP_SOFTMAX
+// the logit margin decides outside the calibrated band. The exact
+// probability is only computed inside the band or for a fault that will
+// be acted on and reported; otherwise the confidence is the bound the
+// margin implies, kept on the side of ML_DECISION_CONFIDENCE it decided.
+ITCM_FUNC ml_result_t ml_model_decide(const float *output) {
+#if ML_SKIP_SOFTMAX
+    ml_result_t result = {0};
+    uint8_t top = 0;
+    float second = -INFINITY;
+
+    for (int i = 1; i < ML_OUTPUT_SIZE; i++) {
+        if (output[i] > output[top]) {
+            second = output[top];
+            top = (uint8_t)i;
+        } else if (output[i] > second) {
+            second = output[i];
+        }
+    }
+
+    float margin = output[top] - second;
+    result.predicted_class = top;
+    result.timestamp = osKernelGetTickCount();
+
+    if (margin < ML_DECISION_MARGIN_LOW) {
+        // Best case for the top class: nothing but the runner-up
+        float bound = 1.0f / (1.0f + expf(-margin));
+        result.confidence = fminf(bound, ML_DECISION_CONFIDENCE);
+    } else if (margin > ML_DECISION_MARGIN_HIGH && top == 0) {
+        // Worst case: every other class right at the runner-up
+        float bound = 1.0f / (1.0f + (ML_OUTPUT_SIZE - 1) * expf(-margin));
+        result.confidence = fmaxf(bound, nextafterf(ML_DECISION_CONFIDENCE, 1.0f));
+    } else {
+        float probabilities[ML_OUTPUT_SIZE];
+        memcpy(probabilities, output, sizeof(probabilities));
+        fault_model_softmax(probabilities);
+        result.confidence = probabilities[top];
+    }
+
+    return result;
+#else
+    return process_ml_output((float *)output);
+#endif
+}
+
+// Blackbox records hold whatever the inference produced; this turns them
+// into probabilities when they are downlinked
+void ml_output_to_probabilities(float *output) {
+#if ML_SKIP_SOFTMAX
+    fault_model_softmax(output);
+#else
+    (void)output;
+#endif
+}
+
 void ml_model_deinit(ml_model_t *model) {
-    ai_network_destroy(model->network);
-    ai_system_deinit();
+    model->network = ai_mnetwork_destroy(model->network);
+
+    taskENTER_CRITICAL();
+    model_info.status = ML_MODEL_NOT_LOADED;
+    taskEXIT_CRITICAL();
+}
+
+void ml_model_get_info(ml_model_info_t *info) {
+    taskENTER_CRITICAL();
+    *info = model_info;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t ml_model_build_report(uint8_t *buffer, uint16_t size) {
+    ml_model_info_t info;
+
+    if (size < ML_MODEL_REPORT_SIZE) {
+        return 0;
+    }
+
+    ml_model_get_info(&info);
+
+    buffer[0] = (uint8_t)info.status;
+    buffer[1] = (uint8_t)info.error.type;
+    buffer[2] = 0;
+    buffer[3] = 0;
+    ttc_put_u32(&buffer[4], info.error.code);
+    ttc_put_u32(&buffer[8], info.macc);
+    ttc_put_u32(&buffer[12], info.nodes);
+    ttc_put_u32(&buffer[16], info.signature);
+    ttc_put_u32(&buffer[20], info.weights_crc);
+    ttc_put_u32(&buffer[24], info.weights_size);
+    ttc_put_u32(&buffer[28], info.activations_size);
+    ttc_put_u32(&buffer[32], info.weights_address);
+    ttc_put_u32(&buffer[36], info.activations_address);
+    ttc_put_u32(&buffer[40], info.init_us);
+    ttc_put_u32(&buffer[44], info.golden_us);
+    ttc_put_u32(&buffer[48], info.golden_error);
+    ttc_put_u32(&buffer[52], info.reloads);
+    ttc_put_u32(&buffer[56], info.reload_us);
+
+    return ML_MODEL_REPORT_SIZE;
 }
\ No newline at end of file
@@ -0,0 +1,334 @@
+#include "model_update.h"
+#include "crc32.h"
+#include "flash_write.h"
+#include "bist.h"
+#include "ml_adaptation.h"
+#include "boot_timeline.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <stddef.h>
+#include <string.h>
+
+#define MODEL_UPDATE_NO_SLOT 0xFF
+#define MODEL_UPDATE_BEGIN_SIZE (2 * 4 + MODEL_UPDATE_HASH_SIZE)
+#define MODEL_UPDATE_CHUNK_OFFSET_SIZE 2
+
+static const uint32_t slot_address[MODEL_UPDATE_SLOT_COUNT] = {
+    MODEL_UPDATE_SLOT_A_ADDRESS,
+    MODEL_UPDATE_SLOT_B_ADDRESS
+};
+
+static const uint8_t factory_hash[MODEL_UPDATE_HASH_SIZE] = MODEL_UPDATE_FACTORY_HASH;
+
+// Upload in progress. The commands and the report run in
+// ttc_monitor_task, and only once the network is up.
+static struct {
+    uint8_t slot;                   // MODEL_UPDATE_NO_SLOT when idle
+    uint32_t size;
+    uint32_t crc;
+    uint8_t model_hash[MODEL_UPDATE_HASH_SIZE];
+    uint32_t received;
+    uint8_t staged[FLASH_WRITE_WORD] __attribute__((aligned(4)));
+} upload;
+
+static ml_model_t *live_model = NULL;
+static uint8_t active_slot = MODEL_UPDATE_FACTORY;  // Changed under ml_pipeline_lock
+static model_update_status_t last_status = MODEL_UPDATE_OK;
+static uint32_t rollbacks = 0;
+
+static const model_update_header_t *slot_header(uint8_t slot) {
+    return (const model_update_header_t *)(slot_address[slot] + MODEL_UPDATE_HEADER_AT);
+}
+
+static const uint8_t *slot_image(uint8_t slot) {
+    return (const uint8_t *)(slot_address[slot] + MODEL_UPDATE_IMAGE_AT);
+}
+
+static uint8_t slot_header_ok(uint8_t slot) {
+    const model_update_header_t *header = slot_header(slot);
+
+    return header->magic == MODEL_UPDATE_MAGIC &&
+           header->header_crc == crc32_compute(header, offsetof(model_update_header_t, header_crc));
+}
+
+// Erased flash reads 0xFF; slot_retire programs the word to zero
+static uint8_t slot_retired(uint8_t slot) {
+    return *(const volatile uint32_t *)(slot_address[slot] + MODEL_UPDATE_RETIRE_AT) != 0xFFFFFFFFUL;
+}
+
+static model_slot_state_t slot_state(uint8_t slot) {
+    const model_update_header_t *header = slot_header(slot);
+
+    if (!slot_header_ok(slot) || header->image_size != MODEL_UPDATE_IMAGE_SIZE ||
+        header->image_crc != crc32_compute(slot_image(slot), header->image_size)) {
+        return MODEL_SLOT_EMPTY;
+    }
+
+    return slot_retired(slot) ? MODEL_SLOT_RETIRED : MODEL_SLOT_VALID;
+}
+
+// Newest valid slot, or MODEL_UPDATE_FACTORY
+static uint8_t best_slot(void) {
+    uint8_t best = MODEL_UPDATE_FACTORY;
+
+    for (uint8_t slot = 0; slot < MODEL_UPDATE_SLOT_COUNT; slot++) {
+        if (slot_state(slot) == MODEL_SLOT_VALID &&
+            (best == MODEL_UPDATE_FACTORY || slot_header(slot)->sequence > slot_header(best)->sequence)) {
+            best = slot;
+        }
+    }
+
+    return best;
+}
+
+static uint8_t slot_retire(uint8_t slot) {
+    static const uint8_t zeros[FLASH_WRITE_WORD] __attribute__((aligned(4))) = {0};
+
+    if (slot_retired(slot)) {
+        return 1;
+    }
+    return flash_write_word(slot_address[slot] + MODEL_UPDATE_RETIRE_AT, zeros);
+}
+
+// The slot's own golden pair through the live network. Under
+// ml_pipeline_lock, with the slot's weights loaded.
+static uint8_t golden_check(uint8_t slot) {
+    const float *input = (const float *)&slot_image(slot)[MODEL_UPDATE_GOLDEN_INPUT_AT];
+    const float *expected = (const float *)&slot_image(slot)[MODEL_UPDATE_GOLDEN_OUTPUT_AT];
+    float output[FAULT_MODEL_OUTPUTS];
+
+    if (!ml_model_evaluate(live_model, input, output)) {
+        return 0;
+    }
+
+    for (int i = 0; i < FAULT_MODEL_OUTPUTS; i++) {
+        float error = output[i] - expected[i];
+        if (error > BIST_GOLDEN_TOLERANCE || error < -BIST_GOLDEN_TOLERANCE) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// Run the newest valid slot, falling back slot by slot to the linked-in
+// weights. Returns 0 if a slot had to be retired on the way.
+static uint8_t model_update_apply(void) {
+    uint8_t accepted = 1;
+
+    for (;;) {
+        uint8_t slot = best_slot();
+
+        const uint8_t *weights = (slot == MODEL_UPDATE_FACTORY) ? ml_model_factory_weights() :
+                                 slot_image(slot);
+
+        ml_pipeline_lock();
+        uint8_t loaded = ml_model_load_weights(live_model, weights);
+        if (loaded && slot != MODEL_UPDATE_FACTORY) {
+            loaded = golden_check(slot);
+        }
+        if (loaded || slot == MODEL_UPDATE_FACTORY) {
+            active_slot = slot;
+            // Verified base in place; any on-board adaptation goes on top
+            ml_adaptation_attach(live_model, weights);
+        }
+        ml_pipeline_unlock();
+
+        if (loaded || slot == MODEL_UPDATE_FACTORY) {
+            return accepted && loaded;
+        }
+
+        // Not programmable means the slot stays valid and would be picked
+        // again; erase it instead
+        if (!slot_retire(slot) && !flash_write_erase(MODEL_UPDATE_SLOT_A_SECTOR + slot)) {
+            return 0;
+        }
+        rollbacks++;
+        accepted = 0;
+    }
+}
+
+static model_update_status_t model_update_result(model_update_status_t status) {
+    last_status = status;
+    return status;
+}
+
+void model_update_init(ml_model_t *model) {
+    memset(&upload, 0, sizeof(upload));
+    upload.slot = MODEL_UPDATE_NO_SLOT;
+    live_model = model;
+    active_slot = MODEL_UPDATE_FACTORY;
+
+    model_update_apply();
+}
+
+// [u32 LE image size][u32 LE image CRC][model_hash]. Erases the slot that
+// is not running; with the linked-in weights running, the one not valid.
+model_update_status_t model_update_begin(const uint8_t *payload, uint8_t length) {
+    if (!boot_timeline_ok(BOOT_STEP_ML_MODEL)) {
+        return model_update_result(MODEL_UPDATE_NOT_READY);
+    }
+    if (length != MODEL_UPDATE_BEGIN_SIZE || ttc_get_u32(&payload[0]) != MODEL_UPDATE_IMAGE_SIZE) {
+        return model_update_result(MODEL_UPDATE_BAD_LENGTH);
+    }
+
+    uint8_t slot = (active_slot != MODEL_UPDATE_FACTORY) ? (uint8_t)(active_slot ^ 1) :
+                   (slot_state(0) == MODEL_SLOT_VALID) ? 1 : 0;
+
+    upload.slot = MODEL_UPDATE_NO_SLOT;
+    upload.size = ttc_get_u32(&payload[0]);
+    upload.crc = ttc_get_u32(&payload[4]);
+    memcpy(upload.model_hash, &payload[8], MODEL_UPDATE_HASH_SIZE);
+    upload.received = 0;
+
+    if (!flash_write_erase(MODEL_UPDATE_SLOT_A_SECTOR + slot)) {
+        return model_update_result(MODEL_UPDATE_FLASH_ERROR);
+    }
+
+    upload.slot = slot;
+    return model_update_result(MODEL_UPDATE_OK);
+}
+
+// [u16 LE image offset][data...], in order. A repeated chunk gets
+// BAD_OFFSET and the report says where to resume.
+model_update_status_t model_update_chunk(const uint8_t *payload, uint8_t length) {
+    if (upload.slot == MODEL_UPDATE_NO_SLOT) {
+        return model_update_result(MODEL_UPDATE_BAD_STATE);
+    }
+    if (length <= MODEL_UPDATE_CHUNK_OFFSET_SIZE) {
+        return model_update_result(MODEL_UPDATE_BAD_LENGTH);
+    }
+
+    uint32_t offset = (uint32_t)payload[0] | ((uint32_t)payload[1] << 8);
+    uint32_t count = length - MODEL_UPDATE_CHUNK_OFFSET_SIZE;
+
+    if (offset != upload.received) {
+        return model_update_result(MODEL_UPDATE_BAD_OFFSET);
+    }
+    if (upload.received + count > upload.size) {
+        return model_update_result(MODEL_UPDATE_BAD_LENGTH);
+    }
+
+    uint32_t image = slot_address[upload.slot] + MODEL_UPDATE_IMAGE_AT;
+    for (uint32_t i = 0; i < count; i++) {
+        upload.staged[upload.received % FLASH_WRITE_WORD] = payload[MODEL_UPDATE_CHUNK_OFFSET_SIZE + i];
+        upload.received++;
+
+        if (upload.received % FLASH_WRITE_WORD == 0 &&
+            !flash_write_word(image + upload.received - FLASH_WRITE_WORD, upload.staged)) {
+            upload.slot = MODEL_UPDATE_NO_SLOT;
+            return model_update_result(MODEL_UPDATE_FLASH_ERROR);
+        }
+    }
+
+    return model_update_result(MODEL_UPDATE_OK);
+}
+
+// Checks the image as written, then writes the header, which is what makes
+// the slot valid, and switches to it if its golden pair passes
+model_update_status_t model_update_commit(void) {
+    if (upload.slot == MODEL_UPDATE_NO_SLOT || upload.received != upload.size) {
+        return model_update_result(MODEL_UPDATE_BAD_STATE);
+    }
+
+    uint8_t slot = upload.slot;
+    uint32_t address = slot_address[slot];
+    upload.slot = MODEL_UPDATE_NO_SLOT;
+
+    // Last partial flash word, padded as erased
+    uint32_t partial = upload.received % FLASH_WRITE_WORD;
+    if (partial > 0) {
+        memset(&upload.staged[partial], 0xFF, FLASH_WRITE_WORD - partial);
+        if (!flash_write_word(address + MODEL_UPDATE_IMAGE_AT + upload.received - partial, upload.staged)) {
+            return model_update_result(MODEL_UPDATE_FLASH_ERROR);
+        }
+    }
+
+    if (crc32_compute(slot_image(slot), upload.size) != upload.crc) {
+        return model_update_result(MODEL_UPDATE_BAD_CRC);
+    }
+
+    model_update_header_t header __attribute__((aligned(4)));
+    memset(&header, 0, sizeof(header));
+    header.magic = MODEL_UPDATE_MAGIC;
+    header.image_size = upload.size;
+    header.image_crc = upload.crc;
+    memcpy(header.model_hash, upload.model_hash, MODEL_UPDATE_HASH_SIZE);
+
+    // Newer than anything written before, retired slots included
+    for (uint8_t other = 0; other < MODEL_UPDATE_SLOT_COUNT; other++) {
+        if (other != slot && slot_header_ok(other) && slot_header(other)->sequence >= header.sequence) {
+            header.sequence = slot_header(other)->sequence + 1;
+        }
+    }
+    header.header_crc = crc32_compute(&header, offsetof(model_update_header_t, header_crc));
+
+    const uint8_t *words = (const uint8_t *)&header;
+    for (uint32_t at = 0; at < sizeof(header); at += FLASH_WRITE_WORD) {
+        if (!flash_write_word(address + MODEL_UPDATE_HEADER_AT + at, &words[at])) {
+            return model_update_result(MODEL_UPDATE_FLASH_ERROR);
+        }
+    }
+
+    if (!model_update_apply()) {
+        return model_update_result(MODEL_UPDATE_GOLDEN_FAIL);
+    }
+    return model_update_result(MODEL_UPDATE_OK);
+}
+
+// Retire the running slot for the other one, or the linked-in weights
+model_update_status_t model_update_rollback(void) {
+    if (!boot_timeline_ok(BOOT_STEP_ML_MODEL)) {
+        return model_update_result(MODEL_UPDATE_NOT_READY);
+    }
+    if (active_slot == MODEL_UPDATE_FACTORY) {
+        return model_update_result(MODEL_UPDATE_BAD_STATE);
+    }
+    if (!slot_retire(active_slot)) {
+        return model_update_result(MODEL_UPDATE_FLASH_ERROR);
+    }
+
+    rollbacks++;
+    model_update_apply();
+    return model_update_result(MODEL_UPDATE_OK);
+}
+
+// The golden pair matching the running weights; left untouched (the
+// self test's own pair) for the linked-in ones. Under ml_pipeline_lock.
+void model_update_golden(const float **input, const float **output) {
+    if (active_slot == MODEL_UPDATE_FACTORY) {
+        return;
+    }
+
+    *input = (const float *)&slot_image(active_slot)[MODEL_UPDATE_GOLDEN_INPUT_AT];
+    *output = (const float *)&slot_image(active_slot)[MODEL_UPDATE_GOLDEN_OUTPUT_AT];
+}
+
+uint16_t model_update_build_report(uint8_t *buffer, uint16_t size) {
+    if (size < MODEL_UPDATE_REPORT_SIZE) {
+        return 0;
+    }
+
+    buffer[0] = (uint8_t)last_status;
+    buffer[1] = active_slot;
+    buffer[2] = upload.slot;
+    buffer[3] = 0;
+    ttc_put_u32(&buffer[4], upload.received);
+    ttc_put_u32(&buffer[8], rollbacks);
+
+    const uint8_t *hash = (active_slot == MODEL_UPDATE_FACTORY) ? factory_hash :
+                          slot_header(active_slot)->model_hash;
+    memcpy(&buffer[12], hash, MODEL_UPDATE_HASH_SIZE);
+
+    uint8_t *entry = &buffer[MODEL_UPDATE_REPORT_HEADER_SIZE];
+    for (uint8_t slot = 0; slot < MODEL_UPDATE_SLOT_COUNT; slot++) {
+        model_slot_state_t state = slot_state(slot);
+
+        entry[0] = (uint8_t)state | ((slot == active_slot) ? MODEL_UPDATE_SLOT_RUNNING : 0);
+        ttc_put_u32(&entry[1], (state != MODEL_SLOT_EMPTY) ? slot_header(slot)->sequence : 0);
+        ttc_put_u32(&entry[5], (state != MODEL_SLOT_EMPTY) ? slot_header(slot)->image_crc : 0);
+        entry += MODEL_UPDATE_REPORT_ENTRY_SIZE;
+    }
+
+    return MODEL_UPDATE_REPORT_SIZE;
+}
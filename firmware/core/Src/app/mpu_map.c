@@ -0,0 +1,82 @@
+#include "mpu_map.h"
+
+// Region map, in MPU region number order. Higher numbers take precedence
+// where regions overlap, so the background region comes first.
+static const mpu_region_t mpu_regions[] = {
+    // Background: no access to the external memory and device windows
+    // (0x60000000-0xDFFFFFFF); code, SRAM, peripherals and the system
+    // space are left to the default map by the disabled subregions
+    {"Background", 0x00000000, MPU_REGION_SIZE_4GB, 0x87, MPU_TYPE_STRONGLY_ORDERED,
+     MPU_ACCESS_SHAREABLE, MPU_REGION_NO_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE},
+
+    // DTCM: stacks, RTOS objects and hot data. Never cached by the core,
+    // marked no-exec so a corrupted return address cannot run data
+    {"DTCM", 0x20000000, MPU_REGION_SIZE_128KB, 0x00, MPU_TYPE_NORMAL_WBWA,
+     MPU_ACCESS_NOT_SHAREABLE, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE},
+
+    // AXI SRAM (320 KB of a 512 KB region): .data, .bss and AI buffers,
+    // write-back / write-allocate
+    {"AXI SRAM", 0x24000000, MPU_REGION_SIZE_512KB, 0xE0, MPU_TYPE_NORMAL_WBWA,
+     MPU_ACCESS_NOT_SHAREABLE, MPU_REGION_FULL_ACCESS,
+#if MPU_AXI_SRAM_EXEC
+     MPU_INSTRUCTION_ACCESS_ENABLE},
+#else
+     MPU_INSTRUCTION_ACCESS_DISABLE},
+#endif
+
+    // D2 SRAM: DMA_BUFFER descriptors and buffers. Non-cacheable, so DMA
+    // and the core always agree without clean/invalidate maintenance
+    {"D2 SRAM DMA", 0x30000000, MPU_REGION_SIZE_32KB, 0x00, MPU_TYPE_NORMAL_NC,
+     MPU_ACCESS_SHAREABLE, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE},
+
+    // D3 SRAM: retained crash context and black-box capture. Non-cacheable so a record written
+    // just before an unexpected reset is already in SRAM
+    {"D3 SRAM", 0x38000000, MPU_REGION_SIZE_16KB, 0x00, MPU_TYPE_NORMAL_NC,
+     MPU_ACCESS_SHAREABLE, MPU_REGION_FULL_ACCESS, MPU_INSTRUCTION_ACCESS_DISABLE},
+};
+
+#define MPU_MAP_REGION_COUNT (sizeof(mpu_regions) / sizeof(mpu_regions[0]))
+
+_Static_assert(MPU_MAP_REGION_COUNT <= 16, "Cortex-M7 MPU has 16 regions");
+
+void mpu_map_apply(void) {
+    MPU_Region_InitTypeDef MPU_InitStruct = {0};
+
+    // D2 SRAM holds the DMA region; make sure its clocks are on
+    __HAL_RCC_D2SRAM1_CLK_ENABLE();
+    __HAL_RCC_D2SRAM2_CLK_ENABLE();
+
+    HAL_MPU_Disable();
+
+    for (uint8_t i = 0; i < MPU_MAP_REGION_COUNT; i++) {
+        const mpu_region_t *region = &mpu_regions[i];
+
+        MPU_InitStruct.Enable = MPU_REGION_ENABLE;
+        MPU_InitStruct.Number = MPU_REGION_NUMBER0 + i;
+        MPU_InitStruct.BaseAddress = region->base;
+        MPU_InitStruct.Size = region->size;
+        MPU_InitStruct.SubRegionDisable = region->subregion_disable;
+        MPU_InitStruct.TypeExtField = region->tex;
+        MPU_InitStruct.AccessPermission = region->access;
+        MPU_InitStruct.DisableExec = region->exec;
+        MPU_InitStruct.IsShareable = region->shareable;
+        MPU_InitStruct.IsCacheable = region->cacheable;
+        MPU_InitStruct.IsBufferable = region->bufferable;
+
+        HAL_MPU_ConfigRegion(&MPU_InitStruct);
+    }
+
+    // Privileged code keeps the default map outside the defined regions
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
+uint8_t mpu_map_region_count(void) {
+    return MPU_MAP_REGION_COUNT;
+}
+
+const mpu_region_t *mpu_map_get_region(uint8_t number) {
+    if (number >= MPU_MAP_REGION_COUNT) {
+        return NULL;
+    }
+    return &mpu_regions[number];
+}
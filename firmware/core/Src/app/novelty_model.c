@@ -0,0 +1,36 @@
+#include "novelty_model.h"
+#include "memory_map.h"
+#include <math.h>
+
+// The forest's score: every tree walked to its leaf and the path lengths
+// summed, one compare per level and no arithmetic until the leaf. Plain C
+// over the generated tables, not an X-CUBE-AI network; novel below
+// novelty_model_path_threshold.
+ITCM_FUNC float novelty_forest_score(const float *features) {
+    float total = 0.0f;
+
+    for (uint16_t tree = 0; tree < novelty_model_tree_count; tree++) {
+        const novelty_node_t *node = &novelty_model_nodes[novelty_model_roots[tree]];
+
+        while (node->feature >= 0) {
+            if (features[node->feature] <= node->value) {
+                node++;
+            } else {
+                node = &novelty_model_nodes[node->right];
+            }
+        }
+        total += node->value;
+    }
+
+    return total;
+}
+
+// Anomaly score in (0, 1) as scikit-learn defines it; around 0.5 and above
+// is novel. Only needed for reporting - the decision uses the path length.
+float novelty_model_anomaly_score(float path_length) {
+    return exp2f(-path_length * novelty_model_path_norm);
+}
+
+uint8_t novelty_model_is_novel(float path_length) {
+    return path_length < novelty_model_path_threshold;
+}
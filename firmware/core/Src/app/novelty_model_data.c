@@ -0,0 +1,2042 @@
+// Generated by cubesat-fault-predictor/novelty_model.py - do not edit,
+// rerun it after retraining
+#include "novelty_model.h"
+
+const uint16_t novelty_model_tree_count = 16;
+const uint16_t novelty_model_node_count = 2026;
+const float novelty_model_path_norm = 7.055425900e-03f;
+const float novelty_model_path_threshold = 9.502354622e+01f;
+
+const uint16_t novelty_model_roots[16] = {
+    0, 129, 274, 399, 526, 633, 764, 865,
+    994, 1095, 1216, 1351, 1498, 1663, 1816, 1921,
+};
+
+const novelty_node_t novelty_model_nodes[2026] = {
+    {4.954637885e-01f, 70, 1, 0},
+    {9.548549056e-01f, 31, 6, 0},
+    {2.130240440e+00f, 10, 2, 0},
+    {4.979530334e+00f, 7, 0, 0},
+    {2.734805489e+01f, 6, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.044289351e+00f, 9, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.532205582e+01f, 18, 3, 0},
+    {4.732396007e-01f, 17, 1, 0},
+    {9.663359833e+01f, 14, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.277121782e+00f, 16, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.717709351e+01f, 26, 5, 0},
+    {2.234909534e+00f, 23, 2, 0},
+    {3.487283325e+01f, 22, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.564960480e+01f, 25, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {2.464929581e+00f, 30, 2, 0},
+    {9.893605804e+01f, 29, 5, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.716803741e+01f, 47, 5, 0},
+    {5.045429707e+00f, 44, 0, 0},
+    {4.660132825e-01f, 41, 1, 0},
+    {2.197548151e+00f, 38, 2, 0},
+    {4.989451885e+00f, 37, 0, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.614141846e+01f, 40, 5, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.990311623e+00f, 43, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.845980406e-01f, 46, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.810369873e+01f, 57, 5, 0},
+    {4.079531860e+01f, 54, 3, 0},
+    {4.285345972e-01f, 51, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.197331429e+00f, 53, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {5.037104130e+00f, 56, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.779252243e+01f, 65, 3, 0},
+    {4.707988501e-01f, 62, 1, 0},
+    {2.279645681e+00f, 61, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.175836182e+01f, 64, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.063451385e+01f, 67, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.091053903e-01f, 69, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.026215076e+00f, 104, 0, 0},
+    {5.491393209e-01f, 87, 1, 0},
+    {4.968858361e-01f, 74, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {9.633905029e+01f, 80, 5, 0},
+    {5.474289656e-01f, 79, 1, 0},
+    {3.259276748e-01f, 78, 6, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.848014832e+01f, 84, 5, 0},
+    {4.962150574e+00f, 83, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {5.162504911e-01f, 86, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {2.987025738e+00f, 103, 2, 0},
+    {9.777740479e+01f, 96, 5, 0},
+    {5.657873154e-01f, 93, 1, 0},
+    {3.229166412e+01f, 92, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.579545593e+01f, 95, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.880030870e+00f, 100, 2, 0},
+    {3.681382751e+01f, 99, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {3.393345261e+01f, 102, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {5.047406673e+00f, 126, 0, 0},
+    {5.293722749e-01f, 115, 1, 0},
+    {4.000614548e+01f, 114, 3, 0},
+    {1.054846123e-01f, 111, 6, 0},
+    {3.739135361e+01f, 110, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.796213531e+01f, 113, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.041759014e+00f, 123, 0, 0},
+    {5.475087762e-01f, 120, 1, 0},
+    {5.033609390e+00f, 119, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.743860626e+01f, 122, 5, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {3.068345070e+01f, 125, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.238740444e-01f, 128, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.551480055e+00f, 209, 2, 0},
+    {2.207206488e+00f, 174, 2, 0},
+    {4.461202621e-01f, 149, 6, 0},
+    {5.005030632e+00f, 144, 0, 0},
+    {9.522592163e+01f, 137, 5, 0},
+    {2.171402931e+00f, 136, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.544384384e+01f, 141, 3, 0},
+    {9.716875458e+01f, 140, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.037544966e+00f, 143, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.064190626e+00f, 146, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.135722399e+00f, 148, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.663099670e+01f, 163, 5, 0},
+    {9.595707703e+01f, 156, 5, 0},
+    {4.023704910e+01f, 153, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.159857273e+00f, 155, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.359884644e+01f, 160, 3, 0},
+    {4.968764305e+00f, 159, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.564377594e+01f, 162, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.884575653e+01f, 169, 5, 0},
+    {2.984392929e+01f, 166, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.992207050e+00f, 168, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {2.110785484e+00f, 173, 2, 0},
+    {2.009698153e+00f, 172, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.420146704e+00f, 190, 2, 0},
+    {9.849198914e+01f, 183, 5, 0},
+    {2.378315687e+00f, 182, 2, 0},
+    {4.977008343e+00f, 179, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.307913065e+00f, 181, 2, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {3.849925399e-01f, 187, 6, 0},
+    {2.298307180e+00f, 186, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.009441853e+00f, 189, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.004058361e+00f, 200, 0, 0},
+    {2.439566612e+00f, 195, 2, 0},
+    {2.426290035e+00f, 194, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.040461421e-01f, 199, 1, 0},
+    {2.485670328e+00f, 198, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.538113594e+00f, 208, 2, 0},
+    {9.878940582e+01f, 205, 5, 0},
+    {4.422287750e+01f, 204, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.918686152e-01f, 207, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.743156433e+01f, 263, 3, 0},
+    {4.986776352e+00f, 236, 0, 0},
+    {1.288024038e-01f, 225, 6, 0},
+    {5.695680976e-01f, 218, 1, 0},
+    {2.656286001e+00f, 215, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.953583241e+00f, 217, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {3.105959702e+01f, 222, 3, 0},
+    {4.975775242e+00f, 221, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.895207644e+00f, 224, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.635388494e-01f, 231, 1, 0},
+    {4.983630180e+00f, 230, 0, 0},
+    {9.754680634e+01f, 229, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.633197021e+01f, 233, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.812118649e-01f, 235, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.757401276e+01f, 250, 5, 0},
+    {1.873499155e-01f, 245, 6, 0},
+    {5.005411148e+00f, 242, 0, 0},
+    {4.997587681e+00f, 241, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {5.609561205e-01f, 244, 1, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.539899468e-01f, 247, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.819729090e+00f, 249, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.884964752e+01f, 258, 5, 0},
+    {5.437559485e-01f, 255, 1, 0},
+    {5.150007010e-01f, 254, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.832591772e+00f, 257, 2, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {5.884215236e-01f, 262, 1, 0},
+    {2.771304607e+00f, 261, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.808014154e+00f, 267, 2, 0},
+    {5.420592427e-01f, 266, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.840497589e+01f, 271, 3, 0},
+    {2.867504060e-01f, 270, 6, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.947043180e+00f, 273, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.573788166e+00f, 332, 2, 0},
+    {4.957897663e+00f, 295, 0, 0},
+    {2.206751585e+00f, 282, 2, 0},
+    {9.737462616e+01f, 281, 5, 0},
+    {4.954704285e+00f, 280, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.104846191e+01f, 288, 3, 0},
+    {2.378797293e+00f, 287, 2, 0},
+    {9.679309082e+01f, 286, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.700675964e+01f, 292, 5, 0},
+    {4.954160213e+00f, 291, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.371012497e+01f, 294, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.121707439e+00f, 309, 2, 0},
+    {4.976963043e+00f, 298, 0, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {5.838676095e-01f, 302, 6, 0},
+    {5.035097599e+00f, 301, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.565595245e+01f, 306, 5, 0},
+    {2.046656609e+00f, 305, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.583656693e+01f, 308, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.013294220e+00f, 323, 0, 0},
+    {9.824745941e+01f, 318, 5, 0},
+    {2.214852810e+00f, 315, 2, 0},
+    {9.663729095e+01f, 314, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {4.977783203e+00f, 317, 0, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {1.156587887e+01f, 0, -1, 0},
+    {2.323309660e+00f, 322, 2, 0},
+    {4.971801758e+00f, 321, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.255918264e-01f, 325, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.503627121e-01f, 329, 1, 0},
+    {2.242213249e+00f, 328, 2, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.936021423e+01f, 331, 3, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.833943129e+00f, 368, 2, 0},
+    {2.324532509e+01f, 343, 3, 0},
+    {5.339358449e-01f, 336, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.197847176e+01f, 342, 3, 0},
+    {5.591031909e-01f, 341, 1, 0},
+    {5.422410965e-01f, 340, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.013910294e+00f, 359, 0, 0},
+    {9.777851868e+01f, 352, 5, 0},
+    {4.374188781e-01f, 349, 6, 0},
+    {9.632239532e+01f, 348, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {3.652706909e+01f, 351, 3, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.882862091e+01f, 356, 5, 0},
+    {4.981841564e+00f, 355, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.984330654e+00f, 358, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.048637867e+00f, 367, 0, 0},
+    {9.644962311e+01f, 364, 5, 0},
+    {3.664956284e+01f, 363, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.022171021e+00f, 366, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.964738846e+00f, 384, 2, 0},
+    {2.852887154e+00f, 373, 2, 0},
+    {5.024412632e+00f, 372, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.008650303e+00f, 379, 0, 0},
+    {4.999925613e+00f, 378, 0, 0},
+    {7.015787065e-02f, 377, 6, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.464101076e-01f, 381, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.028187275e+00f, 383, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {3.843671036e+01f, 394, 3, 0},
+    {2.990728140e+00f, 391, 2, 0},
+    {5.040282249e+00f, 390, 0, 0},
+    {9.771498108e+01f, 389, 5, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.254416275e+01f, 393, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.003883362e+00f, 396, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.595499420e+01f, 398, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.466626406e-01f, 467, 6, 0},
+    {9.657224274e+01f, 428, 5, 0},
+    {4.961683273e+00f, 405, 0, 0},
+    {4.775834978e-01f, 404, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {9.599436188e+01f, 415, 5, 0},
+    {2.416907120e+01f, 408, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.593204498e-01f, 412, 1, 0},
+    {2.369218826e+00f, 411, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {4.990406990e+00f, 414, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.644099474e-01f, 421, 1, 0},
+    {3.577343369e+01f, 420, 3, 0},
+    {2.020691872e+00f, 419, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.792794228e+00f, 425, 2, 0},
+    {2.742891550e+00f, 424, 2, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.036794281e+01f, 427, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.648977661e+01f, 456, 3, 0},
+    {2.478685856e+00f, 443, 2, 0},
+    {3.982552719e+01f, 438, 3, 0},
+    {9.887373352e+01f, 435, 5, 0},
+    {5.016165257e+00f, 434, 0, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.068449974e+00f, 437, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {4.964478493e+00f, 440, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.136071014e+01f, 442, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.992348671e+00f, 449, 0, 0},
+    {5.692951679e-01f, 448, 1, 0},
+    {2.808861256e+00f, 447, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.792811584e+01f, 453, 5, 0},
+    {5.019231319e+00f, 452, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.998794556e+00f, 455, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {4.753588867e+01f, 460, 3, 0},
+    {4.680719376e+01f, 459, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.987735748e+00f, 462, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.819844055e+01f, 464, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.013840199e+00f, 466, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.954063416e+00f, 469, 0, 0},
+    {2.000000000e+00f, 0, -1, 0},
+    {5.008312702e+00f, 499, 0, 0},
+    {5.216100812e-01f, 484, 1, 0},
+    {4.552043080e-01f, 477, 1, 0},
+    {2.210848808e+00f, 476, 2, 0},
+    {9.825988007e+01f, 475, 5, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.423166990e+00f, 481, 2, 0},
+    {4.215756226e+01f, 480, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.484639406e+00f, 483, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {5.548219681e-01f, 492, 1, 0},
+    {5.369567275e-01f, 489, 1, 0},
+    {4.995277882e+00f, 488, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.983933449e+00f, 491, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.888076425e-01f, 496, 1, 0},
+    {4.968306541e+00f, 495, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {2.967317581e+00f, 498, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.983610809e-01f, 513, 1, 0},
+    {2.315639257e+00f, 508, 2, 0},
+    {4.460287988e-01f, 505, 1, 0},
+    {2.075993299e+00f, 504, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.473849297e+01f, 507, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.763386536e+01f, 512, 5, 0},
+    {3.332638168e+01f, 511, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.884278107e+01f, 521, 5, 0},
+    {5.038956165e+00f, 518, 0, 0},
+    {3.346680832e+01f, 517, 3, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.686582947e+01f, 520, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.391037464e-01f, 523, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.897455454e+00f, 525, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.680568576e-01f, 584, 1, 0},
+    {6.924949288e-01f, 551, 6, 0},
+    {4.023548961e-01f, 530, 1, 0},
+    {3.000000000e+00f, 0, -1, 0},
+    {9.874023438e+01f, 546, 5, 0},
+    {5.001553535e+00f, 539, 0, 0},
+    {4.556586146e-01f, 536, 1, 0},
+    {2.148977757e+00f, 535, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {3.315488434e+01f, 538, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.418115616e-01f, 543, 1, 0},
+    {4.336177063e+01f, 542, 3, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.031847477e+00f, 545, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.042997837e+00f, 548, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.255368114e-01f, 550, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.110722303e+00f, 565, 2, 0},
+    {9.698126984e+01f, 560, 5, 0},
+    {9.587792969e+01f, 555, 5, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.996776104e+00f, 557, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.091928899e-01f, 559, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.738461304e+01f, 562, 5, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {3.816337967e+01f, 564, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.231933117e+00f, 573, 2, 0},
+    {4.982634544e+00f, 568, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.725636673e+01f, 572, 3, 0},
+    {5.019943237e+00f, 571, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.895261383e+01f, 577, 3, 0},
+    {5.039824963e+00f, 576, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.009106159e+00f, 581, 0, 0},
+    {9.763756561e+01f, 580, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {4.401998520e+01f, 583, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.907660723e+00f, 614, 2, 0},
+    {5.040807724e+00f, 605, 0, 0},
+    {2.877857208e+00f, 602, 2, 0},
+    {6.434332728e-01f, 595, 6, 0},
+    {5.453541875e-01f, 592, 1, 0},
+    {9.525799561e+01f, 591, 5, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {1.142718697e+01f, 0, -1, 0},
+    {3.086189461e+01f, 594, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {5.005451202e+00f, 599, 0, 0},
+    {2.365070152e+01f, 598, 3, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {1.127809048e+01f, 0, -1, 0},
+    {9.809207916e+01f, 601, 5, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.888349533e+00f, 604, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.041983128e+00f, 607, 0, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.472120762e+00f, 613, 2, 0},
+    {2.769252777e+01f, 612, 3, 0},
+    {2.439634085e+00f, 611, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.980086327e-01f, 632, 1, 0},
+    {2.326020813e+01f, 619, 3, 0},
+    {5.944735408e-01f, 618, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {1.281482577e-01f, 627, 6, 0},
+    {5.017070293e+00f, 624, 0, 0},
+    {5.941368341e-01f, 623, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.955180645e+00f, 626, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.034865856e+00f, 631, 0, 0},
+    {2.931098938e+00f, 630, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.000000000e+00f, 0, -1, 0},
+    {4.045873642e+01f, 711, 3, 0},
+    {1.163364276e-01f, 662, 6, 0},
+    {3.973120499e+01f, 661, 3, 0},
+    {4.259667397e-01f, 646, 1, 0},
+    {5.021989346e+00f, 641, 0, 0},
+    {4.998385906e+00f, 640, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.648798752e+01f, 645, 3, 0},
+    {9.762834930e+01f, 644, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.340530396e+01f, 654, 3, 0},
+    {4.547741115e-01f, 651, 1, 0},
+    {5.024283409e+00f, 650, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.585722542e+01f, 653, 3, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {1.193196869e+01f, 0, -1, 0},
+    {5.009329796e+00f, 658, 0, 0},
+    {5.088973641e-01f, 657, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {2.639506340e+00f, 660, 2, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.000000000e+00f, 0, -1, 0},
+    {4.460487366e-01f, 686, 1, 0},
+    {2.692409706e+01f, 677, 3, 0},
+    {2.216145515e+01f, 672, 3, 0},
+    {2.106890869e+01f, 669, 3, 0},
+    {9.776141357e+01f, 668, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.133714485e+01f, 671, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.637776947e+01f, 674, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.513804817e+01f, 676, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.009248734e+01f, 685, 3, 0},
+    {5.020844460e+00f, 682, 0, 0},
+    {3.036375999e+01f, 681, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.809049225e+01f, 684, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.986080170e+00f, 696, 0, 0},
+    {2.216127396e+01f, 689, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.308659673e-01f, 693, 1, 0},
+    {4.982748508e+00f, 692, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.864403534e+01f, 695, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {2.597131968e+00f, 704, 2, 0},
+    {5.012473106e+00f, 701, 0, 0},
+    {4.702107608e-01f, 700, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.032603264e+00f, 703, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.752072906e+01f, 708, 5, 0},
+    {9.515258789e+01f, 707, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.005970478e+00f, 710, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {4.880121231e+01f, 757, 3, 0},
+    {2.575460672e+00f, 736, 2, 0},
+    {6.030973792e-01f, 725, 6, 0},
+    {4.266677797e-01f, 720, 1, 0},
+    {4.718611908e+01f, 719, 3, 0},
+    {5.005733490e+00f, 718, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.036211491e+00f, 724, 0, 0},
+    {4.549160302e-01f, 723, 1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.410633087e+01f, 733, 3, 0},
+    {9.770861816e+01f, 730, 5, 0},
+    {2.554852247e+00f, 729, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.994464874e+00f, 732, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.332563877e-01f, 735, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.616766357e+01f, 746, 5, 0},
+    {9.526821136e+01f, 743, 5, 0},
+    {5.006745338e+00f, 742, 0, 0},
+    {5.341208577e-01f, 741, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.017172813e+00f, 745, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.316459274e+01f, 752, 3, 0},
+    {2.625282764e+00f, 749, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.026840687e+00f, 751, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.951890945e-01f, 756, 1, 0},
+    {8.633303046e-01f, 755, 6, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.937235641e+01f, 761, 3, 0},
+    {4.908760834e+01f, 760, 3, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {1.418972313e-01f, 763, 6, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {8.292974532e-02f, 814, 6, 0},
+    {2.177048302e+01f, 771, 3, 0},
+    {2.066695786e+01f, 770, 3, 0},
+    {2.018963242e+01f, 769, 3, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {3.000000000e+00f, 0, -1, 0},
+    {5.022921085e+00f, 799, 0, 0},
+    {2.704190063e+01f, 784, 3, 0},
+    {4.374882877e-01f, 779, 1, 0},
+    {9.735846710e+01f, 776, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.474271011e+01f, 778, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.599392712e-01f, 781, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.726622772e+01f, 783, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.691847229e+01f, 792, 3, 0},
+    {4.691271186e-01f, 789, 1, 0},
+    {4.973375320e+00f, 788, 0, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {9.782443237e+01f, 791, 5, 0},
+    {1.074888039e+01f, 0, -1, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {9.634751892e+01f, 796, 5, 0},
+    {9.514468384e+01f, 795, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.322881937e+00f, 798, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.157134628e+01f, 811, 3, 0},
+    {2.624390841e+00f, 808, 2, 0},
+    {2.159108639e+00f, 805, 2, 0},
+    {4.267567694e-01f, 804, 1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.740663147e+01f, 807, 5, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {5.671159625e-01f, 810, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.872218323e+01f, 813, 5, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.579679871e+01f, 828, 5, 0},
+    {3.068318939e+01f, 821, 3, 0},
+    {5.266197920e-01f, 820, 1, 0},
+    {2.523752213e+01f, 819, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {5.152264833e-01f, 823, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.997001171e+00f, 825, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.702050328e-01f, 827, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.434608459e+01f, 852, 3, 0},
+    {2.839278936e+00f, 843, 2, 0},
+    {9.649905396e+01f, 836, 5, 0},
+    {4.491991401e-01f, 833, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.986201286e+00f, 835, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.188829899e-01f, 840, 1, 0},
+    {4.970277786e+00f, 839, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {5.551434755e-01f, 842, 1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.677964020e+01f, 849, 5, 0},
+    {5.841844082e-01f, 848, 1, 0},
+    {5.027941704e+00f, 847, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.778023720e+01f, 851, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.918157196e+01f, 862, 3, 0},
+    {4.952434063e+00f, 855, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.969997883e+00f, 859, 0, 0},
+    {9.795483398e+01f, 858, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.034473419e+00f, 861, 0, 0},
+    {1.169553185e+01f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {2.829802036e+00f, 864, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.749636650e-01f, 925, 1, 0},
+    {4.990629673e+00f, 896, 0, 0},
+    {6.122374162e-02f, 883, 6, 0},
+    {4.964228630e+00f, 874, 0, 0},
+    {2.196774721e+00f, 873, 2, 0},
+    {4.958175659e+00f, 872, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.395849705e-01f, 878, 1, 0},
+    {9.778145599e+01f, 877, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.539529419e+01f, 880, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.502197206e-01f, 882, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.064431906e+00f, 889, 2, 0},
+    {2.038462639e+00f, 888, 2, 0},
+    {4.234132767e+01f, 887, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.521355438e+01f, 893, 5, 0},
+    {2.076480865e+00f, 892, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.565053558e+01f, 895, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.041730881e+00f, 922, 0, 0},
+    {2.621822739e+01f, 909, 3, 0},
+    {2.342404872e-01f, 906, 6, 0},
+    {2.151604414e+00f, 903, 2, 0},
+    {5.008911133e+00f, 902, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.474300444e-01f, 905, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.887187958e+01f, 908, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.645561218e+01f, 915, 5, 0},
+    {4.111627936e-01f, 912, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.504314363e-01f, 914, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.787446594e+01f, 919, 5, 0},
+    {3.461936116e-02f, 918, 6, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.268493950e-01f, 921, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.732881165e+01f, 924, 5, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.469952822e+00f, 943, 2, 0},
+    {2.860162556e-01f, 938, 6, 0},
+    {4.815693796e-01f, 929, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.980248451e+00f, 933, 0, 0},
+    {4.963474274e+00f, 932, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.449937344e+00f, 937, 2, 0},
+    {9.773882294e+01f, 936, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.405694246e+00f, 940, 2, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.971434593e+00f, 942, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.648553967e-01f, 973, 1, 0},
+    {6.402566433e-01f, 960, 6, 0},
+    {5.064695477e-01f, 953, 1, 0},
+    {2.496833324e+00f, 950, 2, 0},
+    {3.174237251e+01f, 949, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.037518740e-01f, 952, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.842103577e+01f, 957, 5, 0},
+    {9.652354431e+01f, 956, 5, 0},
+    {1.111688900e+01f, 0, -1, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {5.014963150e+00f, 959, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.079684448e+01f, 968, 3, 0},
+    {2.668832302e+00f, 965, 2, 0},
+    {2.378384209e+01f, 964, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.699857950e+00f, 967, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {2.768578053e+00f, 972, 2, 0},
+    {9.776908875e+01f, 971, 5, 0},
+    {1.111688900e+01f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.515524292e+01f, 981, 5, 0},
+    {2.869463205e+00f, 978, 2, 0},
+    {4.909944534e-01f, 977, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.913039446e-01f, 980, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.970245838e+00f, 987, 0, 0},
+    {9.696964264e+01f, 986, 5, 0},
+    {4.966352940e+00f, 985, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.699937344e-01f, 991, 1, 0},
+    {4.983752728e+00f, 990, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.892100096e+00f, 993, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {2.219818878e+01f, 1022, 3, 0},
+    {2.132032013e+01f, 1009, 3, 0},
+    {9.838806915e+01f, 1004, 5, 0},
+    {2.636592150e+00f, 1001, 2, 0},
+    {9.678627777e+01f, 1000, 5, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.118096828e-01f, 1003, 6, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.947909415e-01f, 1006, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {5.052980185e-01f, 1008, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.366063833e+00f, 1015, 2, 0},
+    {9.560160828e+01f, 1012, 5, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.078678489e-01f, 1014, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.176872635e+01f, 1019, 3, 0},
+    {5.020861149e+00f, 1018, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.205060840e-01f, 1021, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.958987713e+00f, 1044, 0, 0},
+    {9.870976257e+01f, 1039, 5, 0},
+    {4.957296371e+00f, 1034, 0, 0},
+    {2.287601471e+00f, 1027, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.776666260e+01f, 1031, 5, 0},
+    {4.956053257e+00f, 1030, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.770880640e-01f, 1033, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.363277435e+01f, 1036, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.713588595e-01f, 1038, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.367961407e+00f, 1043, 2, 0},
+    {4.958500862e+00f, 1042, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {3.791823578e+01f, 1074, 3, 0},
+    {3.439026177e-01f, 1059, 6, 0},
+    {5.012297630e+00f, 1054, 0, 0},
+    {4.995624065e+00f, 1051, 0, 0},
+    {9.893972015e+01f, 1050, 5, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {4.560821950e-01f, 1053, 1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.489236641e+01f, 1056, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.573749781e+00f, 1058, 2, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.774559402e+01f, 1067, 3, 0},
+    {9.642877197e+01f, 1064, 5, 0},
+    {5.016443253e+00f, 1063, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.027149677e+00f, 1066, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.010659218e+00f, 1071, 0, 0},
+    {3.069117928e+01f, 1070, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {5.034311295e+00f, 1073, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.897881746e+00f, 1090, 2, 0},
+    {5.017606258e+00f, 1083, 0, 0},
+    {4.883351028e-01f, 1080, 6, 0},
+    {2.645260096e+00f, 1079, 2, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {1.111688900e+01f, 0, -1, 0},
+    {5.001439095e+00f, 1082, 0, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {1.127809048e+01f, 0, -1, 0},
+    {2.511266768e-01f, 1087, 6, 0},
+    {2.643050432e+00f, 1086, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.687363434e+01f, 1089, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.789881897e+01f, 1092, 5, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.929338694e+00f, 1094, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.248639679e+01f, 1173, 3, 0},
+    {5.032646179e+00f, 1144, 0, 0},
+    {2.566342354e+00f, 1123, 2, 0},
+    {5.017595768e+00f, 1112, 0, 0},
+    {3.027029037e+01f, 1105, 3, 0},
+    {9.835788727e+01f, 1104, 5, 0},
+    {2.252550840e+00f, 1103, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.988622189e+00f, 1109, 0, 0},
+    {4.123129272e+01f, 1108, 3, 0},
+    {1.142718697e+01f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {3.552655029e+01f, 1111, 3, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {9.552893066e+01f, 1118, 5, 0},
+    {4.221363962e-01f, 1115, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.357457876e+00f, 1117, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.837809753e+01f, 1120, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.633291960e-01f, 1122, 1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.173256397e-01f, 1129, 1, 0},
+    {4.992668629e+00f, 1126, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.882038236e-01f, 1128, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.499934769e+01f, 1137, 3, 0},
+    {9.734653473e+01f, 1134, 5, 0},
+    {5.237916708e-01f, 1133, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {1.156587887e+01f, 0, -1, 0},
+    {5.467374921e-01f, 1136, 1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.651028156e+00f, 1141, 2, 0},
+    {9.677436066e+01f, 1140, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.512931061e+01f, 1143, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {2.554154158e+00f, 1160, 2, 0},
+    {9.693237305e+01f, 1149, 5, 0},
+    {4.121634960e-01f, 1148, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.852077484e+01f, 1157, 5, 0},
+    {9.792794037e+01f, 1154, 5, 0},
+    {5.045422077e+00f, 1153, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.161923528e-01f, 1156, 6, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.709264338e-01f, 1159, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.825032592e-01f, 1172, 1, 0},
+    {2.852114439e+00f, 1167, 2, 0},
+    {9.647076416e+01f, 1164, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.710639763e+01f, 1166, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.585122108e+01f, 1169, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.801371002e+01f, 1171, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.481986237e+01f, 1189, 3, 0},
+    {2.612020016e+00f, 1180, 2, 0},
+    {5.029047489e+00f, 1179, 0, 0},
+    {4.306162596e-01f, 1178, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {9.735199738e+01f, 1186, 5, 0},
+    {5.903010964e-01f, 1185, 1, 0},
+    {3.828778863e-01f, 1184, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.417987704e-01f, 1188, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.981004238e+00f, 1199, 0, 0},
+    {4.959775448e+00f, 1192, 0, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.974762917e+00f, 1194, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.977168083e+00f, 1196, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.726189613e-01f, 1198, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.650315642e-01f, 1205, 1, 0},
+    {5.009890556e+00f, 1204, 0, 0},
+    {4.519870579e-01f, 1203, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.002586365e+00f, 1209, 0, 0},
+    {4.912864685e+01f, 1208, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.020411491e+00f, 1213, 0, 0},
+    {2.869881868e+00f, 1212, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.628614187e+00f, 1215, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.500125122e+01f, 1268, 5, 0},
+    {4.763661027e-01f, 1243, 1, 0},
+    {4.985857010e+00f, 1226, 0, 0},
+    {4.977452755e+00f, 1225, 0, 0},
+    {2.684654808e+01f, 1222, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.960224628e+00f, 1224, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {5.995149016e-01f, 1236, 6, 0},
+    {4.308136702e-01f, 1231, 1, 0},
+    {5.014624596e+00f, 1230, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.368667901e-01f, 1233, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.567619860e-01f, 1235, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.208159637e+01f, 1238, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.030701160e+00f, 1240, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.397558868e-01f, 1242, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.540093780e-01f, 1261, 1, 0},
+    {1.475894898e-01f, 1256, 6, 0},
+    {2.583345652e+00f, 1253, 2, 0},
+    {4.996622801e-01f, 1250, 1, 0},
+    {2.477339745e+00f, 1249, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.007523060e+00f, 1252, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.302747488e-01f, 1255, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.250162482e-01f, 1260, 1, 0},
+    {2.434668779e+00f, 1259, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {3.333445740e+01f, 1265, 3, 0},
+    {5.575693250e-01f, 1264, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.489345932e+01f, 1267, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.274119854e+00f, 1302, 2, 0},
+    {2.162879229e+00f, 1289, 2, 0},
+    {9.673389435e+01f, 1276, 5, 0},
+    {3.550287628e+01f, 1275, 3, 0},
+    {3.131409454e+01f, 1274, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.104624987e+00f, 1284, 2, 0},
+    {2.065392971e+00f, 1281, 2, 0},
+    {2.030629158e+00f, 1280, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.913406134e-01f, 1283, 6, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.817006588e-01f, 1288, 6, 0},
+    {3.784193802e+01f, 1287, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.180764771e+01f, 1293, 3, 0},
+    {4.488504231e-01f, 1292, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.265753984e+00f, 1301, 2, 0},
+    {4.372615516e-01f, 1298, 1, 0},
+    {5.040007114e+00f, 1297, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.939189553e-01f, 1300, 6, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.813625813e-01f, 1328, 6, 0},
+    {4.993811607e+00f, 1315, 0, 0},
+    {2.623386621e+00f, 1308, 2, 0},
+    {9.620729828e+01f, 1307, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.824979305e+00f, 1312, 2, 0},
+    {5.643835068e-01f, 1311, 1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.969307423e+00f, 1314, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.002451539e-01f, 1321, 1, 0},
+    {5.044694901e+00f, 1320, 0, 0},
+    {4.999845505e+00f, 1319, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.860355377e+01f, 1325, 5, 0},
+    {5.027821064e+00f, 1324, 0, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {2.622563601e+00f, 1327, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {2.801635981e+00f, 1342, 2, 0},
+    {2.325097847e+01f, 1335, 3, 0},
+    {2.499910831e+00f, 1332, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.802596283e+01f, 1334, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.479800701e-01f, 1339, 1, 0},
+    {9.858612823e+01f, 1338, 5, 0},
+    {1.204043770e+01f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {5.509514809e-01f, 1341, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.925787091e-01f, 1350, 1, 0},
+    {3.142736053e+01f, 1347, 3, 0},
+    {4.986041546e+00f, 1346, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.001724720e+00f, 1349, 0, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.993347168e+00f, 1415, 0, 0},
+    {4.987752914e+00f, 1396, 0, 0},
+    {3.108598518e+01f, 1371, 3, 0},
+    {7.693701982e-01f, 1364, 6, 0},
+    {2.927047014e+00f, 1363, 2, 0},
+    {2.775990248e+00f, 1360, 2, 0},
+    {2.485562325e+00f, 1359, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.652123690e-01f, 1362, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.676852417e+01f, 1366, 5, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.644467533e-01f, 1370, 1, 0},
+    {4.974319935e+00f, 1369, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.270068359e+01f, 1387, 3, 0},
+    {2.846094847e+00f, 1380, 2, 0},
+    {4.975599766e+00f, 1377, 0, 0},
+    {2.145211697e+00f, 1376, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {4.977107048e+00f, 1379, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {3.584602356e+01f, 1384, 3, 0},
+    {4.980560303e+00f, 1383, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.032897323e-01f, 1386, 6, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.834706116e+01f, 1393, 5, 0},
+    {9.684302521e+01f, 1392, 5, 0},
+    {2.130630732e+00f, 1391, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.777231455e-01f, 1395, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.991889000e+00f, 1408, 0, 0},
+    {4.988828659e+00f, 1399, 0, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.919925630e-01f, 1403, 6, 0},
+    {4.215800095e+01f, 1402, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.581758881e+01f, 1405, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.810511017e+01f, 1407, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.992477894e+00f, 1412, 0, 0},
+    {7.847704291e-01f, 1411, 6, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.713061905e+01f, 1414, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {3.713638687e+01f, 1459, 3, 0},
+    {5.007964611e+00f, 1428, 0, 0},
+    {4.289290905e-01f, 1419, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.997272491e+00f, 1421, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.577200413e-01f, 1425, 1, 0},
+    {3.396870568e-02f, 1424, 6, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.135964274e-01f, 1427, 6, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.304135799e-01f, 1444, 6, 0},
+    {9.856654358e+01f, 1437, 5, 0},
+    {5.240985751e-01f, 1434, 1, 0},
+    {9.653606415e+01f, 1433, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {5.023354053e+00f, 1436, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.692438483e-01f, 1441, 1, 0},
+    {2.495835543e+00f, 1440, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.991661549e+00f, 1443, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.787461162e-01f, 1452, 1, 0},
+    {4.484348595e-01f, 1449, 1, 0},
+    {5.022135735e+00f, 1448, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.435738754e+01f, 1451, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.409333801e+01f, 1456, 3, 0},
+    {2.759692192e+00f, 1455, 2, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.032300472e+00f, 1458, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {3.024143577e-01f, 1471, 6, 0},
+    {2.932320356e+00f, 1470, 2, 0},
+    {9.812869263e+01f, 1469, 5, 0},
+    {9.670178223e+01f, 1466, 5, 0},
+    {9.584388733e+01f, 1465, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.727080536e+01f, 1468, 5, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {9.593003082e+01f, 1483, 5, 0},
+    {5.031692505e+00f, 1480, 0, 0},
+    {5.242049694e-01f, 1477, 1, 0},
+    {4.544021606e+01f, 1476, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.013862133e+00f, 1479, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.570986032e+00f, 1482, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.635855103e+01f, 1491, 5, 0},
+    {4.745836639e+01f, 1488, 3, 0},
+    {4.087480545e+01f, 1487, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.008579254e+00f, 1490, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.051518679e-01f, 1495, 1, 0},
+    {2.486059666e+00f, 1494, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.767209291e+00f, 1497, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.767470479e-01f, 1586, 6, 0},
+    {3.997072983e+01f, 1549, 3, 0},
+    {2.895406532e+01f, 1524, 3, 0},
+    {9.551016235e+01f, 1511, 5, 0},
+    {5.103859901e-01f, 1510, 1, 0},
+    {4.980239391e+00f, 1507, 0, 0},
+    {2.241614580e+00f, 1506, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.598798752e-01f, 1509, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.748183727e+00f, 1519, 2, 0},
+    {9.620755768e+01f, 1516, 5, 0},
+    {4.834207296e-01f, 1515, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.190755367e+00f, 1518, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {5.554929376e-01f, 1521, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.543060303e+01f, 1523, 3, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.190151334e-01f, 1538, 1, 0},
+    {5.023677826e+00f, 1533, 0, 0},
+    {4.361022115e-01f, 1530, 1, 0},
+    {9.832029724e+01f, 1529, 5, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.595713913e-01f, 1532, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.519354343e+00f, 1535, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.562574148e+00f, 1537, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.755035400e+01f, 1546, 5, 0},
+    {3.146737671e+01f, 1543, 3, 0},
+    {5.028347969e+00f, 1542, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.562990570e+01f, 1545, 5, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {2.816634417e+00f, 1548, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.371627808e+00f, 1563, 2, 0},
+    {9.512837219e+01f, 1556, 5, 0},
+    {2.175978184e+00f, 1553, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.338573217e+00f, 1555, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.985277176e+00f, 1558, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.085797369e-01f, 1560, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.001998901e+00f, 1562, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.932076931e+00f, 1579, 2, 0},
+    {4.327003860e+01f, 1572, 3, 0},
+    {5.002599716e+00f, 1569, 0, 0},
+    {5.686495304e-01f, 1568, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.256964874e+01f, 1571, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.657393646e+01f, 1576, 5, 0},
+    {4.669440842e+01f, 1575, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.669277191e+01f, 1578, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {5.016635895e+00f, 1583, 0, 0},
+    {9.772817230e+01f, 1582, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.949724436e+00f, 1585, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.682833862e+01f, 1624, 5, 0},
+    {4.734697342e-01f, 1605, 1, 0},
+    {5.040215969e+00f, 1604, 0, 0},
+    {9.547490692e+01f, 1597, 5, 0},
+    {2.210621834e+00f, 1594, 2, 0},
+    {5.005722523e+00f, 1593, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.529898167e-01f, 1596, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {2.236726999e+00f, 1601, 2, 0},
+    {2.787975693e+01f, 1600, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {3.647974777e+01f, 1603, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.808966637e+00f, 1615, 2, 0},
+    {5.397260189e-01f, 1612, 1, 0},
+    {2.981013680e+01f, 1609, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.501411915e+00f, 1611, 2, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.760722160e+00f, 1614, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.950966120e+00f, 1619, 2, 0},
+    {2.858774424e+00f, 1618, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.014478207e+00f, 1621, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.540225983e+01f, 1623, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.987044930e-01f, 1644, 1, 0},
+    {4.979074001e+00f, 1633, 0, 0},
+    {2.389944077e+00f, 1632, 2, 0},
+    {4.574507141e+01f, 1631, 3, 0},
+    {4.352734983e-01f, 1630, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.790419006e+01f, 1637, 5, 0},
+    {4.732111990e-01f, 1636, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.762374496e+01f, 1641, 3, 0},
+    {2.327771759e+01f, 1640, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {2.345647335e+00f, 1643, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.288990736e-01f, 1650, 1, 0},
+    {2.549580812e+00f, 1647, 2, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.993032932e+00f, 1649, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.821802020e-01f, 1658, 1, 0},
+    {5.569229722e-01f, 1655, 1, 0},
+    {5.006273270e+00f, 1654, 0, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.680836439e-01f, 1657, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.838333130e+01f, 1660, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.029899120e+00f, 1662, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.095980763e-01f, 1761, 1, 0},
+    {4.666814208e-01f, 1714, 1, 0},
+    {3.397853470e+01f, 1687, 3, 0},
+    {2.286385775e+00f, 1680, 2, 0},
+    {4.974039555e+00f, 1673, 0, 0},
+    {3.300090134e-01f, 1672, 6, 0},
+    {4.966070175e+00f, 1671, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.159745455e+00f, 1677, 2, 0},
+    {4.115986824e-01f, 1676, 1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.556423950e+01f, 1679, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.605169678e+01f, 1684, 5, 0},
+    {4.617441297e-01f, 1683, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.051751792e-01f, 1686, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.783240509e+01f, 1703, 5, 0},
+    {6.895998716e-01f, 1696, 6, 0},
+    {9.628136444e+01f, 1693, 5, 0},
+    {4.789206696e+01f, 1692, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.453754127e-01f, 1695, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.037691593e+00f, 1700, 0, 0},
+    {9.632186890e+01f, 1699, 5, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.064875841e-01f, 1702, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.197807312e+00f, 1711, 2, 0},
+    {2.118336201e+00f, 1708, 2, 0},
+    {4.996216297e+00f, 1707, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.439887619e+01f, 1710, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.999570370e+00f, 1713, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.046547318e+01f, 1738, 3, 0},
+    {4.860013127e-01f, 1725, 1, 0},
+    {4.707705677e-01f, 1720, 1, 0},
+    {5.037733555e+00f, 1719, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.448822141e-01f, 1722, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {9.658720398e+01f, 1724, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {4.994992733e+00f, 1733, 0, 0},
+    {3.089926910e+01f, 1730, 3, 0},
+    {4.970827103e+00f, 1729, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.364759827e+01f, 1732, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {9.562318420e+01f, 1735, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.053035021e-01f, 1737, 1, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.424149752e+00f, 1748, 2, 0},
+    {4.506100082e+01f, 1745, 3, 0},
+    {4.133432770e+01f, 1744, 3, 0},
+    {9.537602234e+01f, 1743, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.964777470e+00f, 1747, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.467685699e+00f, 1756, 2, 0},
+    {4.991282463e+00f, 1753, 0, 0},
+    {2.434837818e+00f, 1752, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.842635393e-01f, 1755, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.530088663e+00f, 1760, 2, 0},
+    {4.919221401e-01f, 1759, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.691198921e+01f, 1785, 3, 0},
+    {5.406030416e-01f, 1778, 1, 0},
+    {2.262668610e+01f, 1771, 3, 0},
+    {4.969208717e+00f, 1768, 0, 0},
+    {2.169403267e+01f, 1767, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.300751925e-01f, 1770, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.636193848e+01f, 1777, 3, 0},
+    {5.183618069e-01f, 1774, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.002263069e+00f, 1776, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.729004741e-01f, 1780, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.442406273e+01f, 1784, 3, 0},
+    {9.610000610e+01f, 1783, 5, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.130454898e-01f, 1787, 1, 0},
+    {3.000000000e+00f, 0, -1, 0},
+    {9.505075073e+01f, 1801, 5, 0},
+    {3.625074005e+01f, 1794, 3, 0},
+    {1.938601434e-01f, 1791, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.027626991e+00f, 1793, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.682357311e+00f, 1798, 2, 0},
+    {5.328472853e-01f, 1797, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.900035143e+00f, 1800, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.845336151e+01f, 1809, 5, 0},
+    {9.671841431e+01f, 1806, 5, 0},
+    {5.569583774e-01f, 1805, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {8.944294453e-01f, 1808, 6, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {1.165582240e-01f, 1813, 6, 0},
+    {4.999200344e+00f, 1812, 0, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {3.988317108e+01f, 1815, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.091891766e+00f, 1844, 2, 0},
+    {2.038106918e+00f, 1827, 2, 0},
+    {8.848919272e-01f, 1824, 6, 0},
+    {4.040468633e-01f, 1821, 1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {3.425290680e+01f, 1823, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {3.855336380e+01f, 1826, 3, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {8.493975550e-02f, 1833, 6, 0},
+    {5.001555920e+00f, 1832, 0, 0},
+    {4.151958823e-01f, 1831, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.670290947e+01f, 1837, 3, 0},
+    {5.034835815e+00f, 1836, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.583330536e+01f, 1843, 5, 0},
+    {2.053794146e+00f, 1840, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.974265099e+00f, 1842, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.885985851e+00f, 1900, 2, 0},
+    {9.794754028e+01f, 1871, 5, 0},
+    {4.692824483e-01f, 1860, 1, 0},
+    {2.154088736e+00f, 1853, 2, 0},
+    {2.988456917e+01f, 1850, 3, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.097790003e+00f, 1852, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.023726940e+00f, 1857, 0, 0},
+    {4.997526169e+00f, 1856, 0, 0},
+    {1.029625130e+01f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {4.471667707e-01f, 1859, 6, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.684320068e+01f, 1866, 5, 0},
+    {5.036586761e+00f, 1865, 0, 0},
+    {5.219903588e-01f, 1864, 1, 0},
+    {1.142718697e+01f, 0, -1, 0},
+    {1.127809048e+01f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {4.575598526e+01f, 1870, 3, 0},
+    {5.041142464e+00f, 1869, 0, 0},
+    {1.053553677e+01f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.726477861e+00f, 1887, 2, 0},
+    {4.494206619e+01f, 1880, 3, 0},
+    {3.366809845e+01f, 1877, 3, 0},
+    {2.365449905e+00f, 1876, 2, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {1.111688900e+01f, 0, -1, 0},
+    {4.390258789e+01f, 1879, 3, 0},
+    {1.094141960e+01f, 0, -1, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {4.998541832e+00f, 1884, 0, 0},
+    {4.487416744e-01f, 1883, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.035478115e+00f, 1886, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.699062586e-01f, 1893, 6, 0},
+    {5.473014116e-01f, 1890, 1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {3.567918396e+01f, 1892, 3, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {5.014912605e+00f, 1897, 0, 0},
+    {9.827857208e+01f, 1896, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {3.160944176e+01f, 1899, 3, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.889185333e+01f, 1918, 5, 0},
+    {5.159866214e-01f, 1913, 6, 0},
+    {9.791854858e+01f, 1908, 5, 0},
+    {2.999729156e+00f, 1907, 2, 0},
+    {9.546852875e+01f, 1906, 5, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.921561718e-01f, 1912, 1, 0},
+    {5.914382339e-01f, 1911, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.976941109e+00f, 1917, 2, 0},
+    {2.970769882e+00f, 1916, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {3.582571793e+01f, 1920, 3, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.705436945e+00f, 1975, 2, 0},
+    {4.081620574e-01f, 1930, 1, 0},
+    {4.993946552e+00f, 1927, 0, 0},
+    {2.018111229e+00f, 1926, 2, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {9.556336975e+01f, 1929, 5, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {2.084226161e-01f, 1950, 6, 0},
+    {2.156266022e+01f, 1935, 3, 0},
+    {5.002471447e+00f, 1934, 0, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.099413991e-01f, 1943, 1, 0},
+    {9.566691589e+01f, 1940, 5, 0},
+    {4.521762431e-01f, 1939, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.362837374e-01f, 1942, 1, 0},
+    {1.111688900e+01f, 0, -1, 0},
+    {1.127809048e+01f, 0, -1, 0},
+    {5.002875328e+00f, 1947, 0, 0},
+    {4.876783371e+01f, 1946, 3, 0},
+    {1.074888039e+01f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {2.597910881e+00f, 1949, 2, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {3.467332840e+01f, 1960, 3, 0},
+    {5.405877829e-01f, 1959, 1, 0},
+    {2.486206436e+01f, 1956, 3, 0},
+    {2.101618385e+01f, 1955, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {4.596095085e-01f, 1958, 1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {4.544535875e-01f, 1968, 1, 0},
+    {4.311758876e-01f, 1965, 1, 0},
+    {2.063270569e+00f, 1964, 2, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {4.322988391e-01f, 1967, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {9.327019691e+00f, 0, -1, 0},
+    {4.075552750e+01f, 1972, 3, 0},
+    {2.657249689e+00f, 1971, 2, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.727015495e-01f, 1974, 1, 0},
+    {8.851655960e+00f, 0, -1, 0},
+    {9.706640244e+00f, 0, -1, 0},
+    {5.014677525e+00f, 1999, 0, 0},
+    {5.516923070e-01f, 1982, 1, 0},
+    {4.976823330e+00f, 1979, 0, 0},
+    {4.000000000e+00f, 0, -1, 0},
+    {3.998764420e+01f, 1981, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.766509533e+00f, 1988, 2, 0},
+    {5.545004010e-01f, 1987, 1, 0},
+    {2.742669821e+00f, 1986, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.595805645e-01f, 1992, 1, 0},
+    {2.793342352e+00f, 1991, 2, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {2.430390930e+01f, 1996, 3, 0},
+    {5.002465248e+00f, 1995, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {4.951008320e+00f, 1998, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {1.002366447e+01f, 0, -1, 0},
+    {9.772463226e+01f, 2015, 5, 0},
+    {5.631116629e-01f, 2006, 1, 0},
+    {2.775582790e+00f, 2005, 2, 0},
+    {5.047150135e+00f, 2004, 0, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.691019440e+01f, 2014, 5, 0},
+    {9.599441528e+01f, 2011, 5, 0},
+    {5.793832541e-01f, 2010, 1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {3.995075989e+01f, 2013, 3, 0},
+    {8.207392693e+00f, 0, -1, 0},
+    {8.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.821479797e+01f, 2019, 5, 0},
+    {5.628812909e-01f, 2018, 1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {2.958461952e+01f, 2021, 3, 0},
+    {5.000000000e+00f, 0, -1, 0},
+    {9.923958033e-02f, 2023, 6, 0},
+    {6.000000000e+00f, 0, -1, 0},
+    {5.043358326e+00f, 2025, 0, 0},
+    {7.000000000e+00f, 0, -1, 0},
+    {7.000000000e+00f, 0, -1, 0},
+};
@@ -0,0 +1,80 @@
+#include "novelty_monitor.h"
+#include "novelty_model.h"
+#include "cycle_counter.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+#include <math.h>
+
+static novelty_stats_t stats;
+
+void novelty_monitor_init(void) {
+    memset(&stats, 0, sizeof(stats));
+    stats.min_path_length = INFINITY;
+}
+
+// Called by ml_inference_task for every sample; returns 1 when it is novel
+uint8_t novelty_monitor_sample(const float *features) {
+    uint32_t start = cycle_counter_now();
+    float path_length = novelty_forest_score(features);
+    uint32_t cycles = cycle_counter_now() - start;
+    uint8_t novel = novelty_model_is_novel(path_length);
+
+    taskENTER_CRITICAL();
+    stats.samples++;
+    stats.cycles += cycles;
+    if (cycles > stats.max_cycles) {
+        stats.max_cycles = cycles;
+    }
+    stats.last_path_length = path_length;
+    if (path_length < stats.min_path_length) {
+        stats.min_path_length = path_length;
+    }
+    if (novel) {
+        stats.novel++;
+    }
+    taskEXIT_CRITICAL();
+
+    return novel;
+}
+
+void novelty_monitor_note_unexplained(void) {
+    taskENTER_CRITICAL();
+    stats.unexplained++;
+    taskEXIT_CRITICAL();
+}
+
+void novelty_monitor_get_stats(novelty_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = stats;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t novelty_monitor_build_report(uint8_t *buffer, uint16_t size) {
+    novelty_stats_t snapshot;
+    uint32_t last_score = 0;
+    uint32_t max_score = 0;
+
+    if (size < NOVELTY_REPORT_SIZE) {
+        return 0;
+    }
+
+    novelty_monitor_get_stats(&snapshot);
+
+    if (snapshot.samples > 0) {
+        last_score = (uint32_t)(novelty_model_anomaly_score(snapshot.last_path_length) * 10000.0f);
+        max_score = (uint32_t)(novelty_model_anomaly_score(snapshot.min_path_length) * 10000.0f);
+    }
+
+    ttc_put_u32(&buffer[0], snapshot.samples);
+    ttc_put_u32(&buffer[4], snapshot.novel);
+    ttc_put_u32(&buffer[8], snapshot.unexplained);
+    ttc_put_u32(&buffer[12], snapshot.samples ? (uint32_t)(snapshot.cycles / snapshot.samples) : 0);
+    ttc_put_u32(&buffer[16], snapshot.max_cycles);
+    ttc_put_u32(&buffer[20], last_score);
+    ttc_put_u32(&buffer[24], max_score);
+    ttc_put_u32(&buffer[28], NOVELTY_MODEL_FLASH_BYTES());
+    ttc_put_u32(&buffer[32], novelty_model_tree_count);
+
+    return NOVELTY_REPORT_SIZE;
+}
@@ -0,0 +1,173 @@
+#include "perf_bench.h"
+#include "cycle_counter.h"
+#include "memory_map.h"
+#include "fault_model_kernel.h"
+#include "app_x-cube-ai.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+static perf_bench_result_t bench;
+
+// Runs on the last features - timing is data independent. The runtime
+// reuses its input buffer for activations, so it is reloaded every run.
+static uint32_t bench_inference(ml_model_t *model, uint32_t *min, uint32_t *max) {
+    uint64_t total = 0;
+
+    *min = UINT32_MAX;
+    *max = 0;
+
+    for (int i = 0; i < PERF_BENCH_INFERENCE_RUNS; i++) {
+        uint32_t start = cycle_counter_now();
+        memcpy(model->ai_input->data, model->input_buffer, FAULT_MODEL_INPUTS * sizeof(float));
+        ai_mnetwork_run(model->network, model->ai_input, model->ai_output);
+        uint32_t cycles = cycle_counter_now() - start;
+
+        total += cycles;
+        if (cycles < *min) {
+            *min = cycles;
+        }
+        if (cycles > *max) {
+            *max = cycles;
+        }
+    }
+
+    return (uint32_t)(total / PERF_BENCH_INFERENCE_RUNS);
+}
+
+static uint32_t bench_kernel(ml_model_t *model, uint32_t *min, uint32_t *max) {
+    float output[FAULT_MODEL_OUTPUTS];
+    uint64_t total = 0;
+
+    *min = UINT32_MAX;
+    *max = 0;
+
+    for (int i = 0; i < PERF_BENCH_INFERENCE_RUNS; i++) {
+        uint32_t start = cycle_counter_now();
+        fault_model_kernel_run(model->input_buffer, output);
+        uint32_t cycles = cycle_counter_now() - start;
+
+        total += cycles;
+        if (cycles < *min) {
+            *min = cycles;
+        }
+        if (cycles > *max) {
+            *max = cycles;
+        }
+    }
+
+    return (uint32_t)(total / PERF_BENCH_INFERENCE_RUNS);
+}
+
+// Both kernels on the same features; the softmax outputs are positive, so
+// their bit patterns order like the values and subtract to a ULP distance
+static uint32_t compare_kernels(ml_model_t *model) {
+    float fused[FAULT_MODEL_OUTPUTS];
+    uint32_t worst = 0;
+
+    memcpy(model->ai_input->data, model->input_buffer, FAULT_MODEL_INPUTS * sizeof(float));
+    ai_mnetwork_run(model->network, model->ai_input, model->ai_output);
+    fault_model_kernel_run(model->input_buffer, fused);
+
+    const float *runtime = (const float *)model->ai_output->data;
+    for (int i = 0; i < FAULT_MODEL_OUTPUTS; i++) {
+        int32_t a, b;
+        memcpy(&a, &runtime[i], sizeof(a));
+        memcpy(&b, &fused[i], sizeof(b));
+
+        uint32_t ulp = (uint32_t)((a > b) ? a - b : b - a);
+        if (ulp > worst) {
+            worst = ulp;
+        }
+    }
+
+    return worst;
+}
+
+static void bench_isr(uint32_t *min, uint32_t *max) {
+    *min = UINT32_MAX;
+    *max = 0;
+
+    // EXTI15_10 with no line pending: full entry, HAL dispatch and exit,
+    // but no reset request is raised
+    for (int i = 0; i < PERF_BENCH_ISR_RUNS; i++) {
+        uint32_t start = cycle_counter_now();
+        NVIC_SetPendingIRQ(EXTI15_10_IRQn);
+        __DSB();
+        __ISB();
+        uint32_t cycles = cycle_counter_now() - start;
+
+        if (cycles < *min) {
+            *min = cycles;
+        }
+        if (cycles > *max) {
+            *max = cycles;
+        }
+    }
+}
+
+void perf_bench_run(ml_model_t *model) {
+    perf_bench_result_t result = {0};
+
+    // Keep other tasks out of the measurement; interrupts stay enabled.
+    // The lock first: a preempted self test may be mid-inference.
+    ml_pipeline_lock();
+    vTaskSuspendAll();
+    result.inference_avg_cycles = bench_inference(model, &result.inference_min_cycles,
+                                                  &result.inference_max_cycles);
+    result.kernel_avg_cycles = bench_kernel(model, &result.kernel_min_cycles,
+                                            &result.kernel_max_cycles);
+    result.kernel_max_ulp = compare_kernels(model);
+    bench_isr(&result.isr_min_cycles, &result.isr_max_cycles);
+    xTaskResumeAll();
+    ml_pipeline_unlock();
+
+    result.tcm_enabled = MEMORY_MAP_USE_TCM;
+    result.fused_kernel = ML_FUSED_KERNEL;
+    result.valid = 1;
+
+    taskENTER_CRITICAL();
+    result.inference_last_cycles = bench.inference_last_cycles;
+    result.inference_worst_cycles = bench.inference_worst_cycles;
+    bench = result;
+    taskEXIT_CRITICAL();
+}
+
+void perf_bench_note_inference(uint32_t cycles) {
+    bench.inference_last_cycles = cycles;
+    if (cycles > bench.inference_worst_cycles) {
+        bench.inference_worst_cycles = cycles;
+    }
+}
+
+void perf_bench_get(perf_bench_result_t *result) {
+    taskENTER_CRITICAL();
+    *result = bench;
+    taskEXIT_CRITICAL();
+}
+
+uint16_t perf_bench_build_report(uint8_t *buffer, uint16_t size) {
+    perf_bench_result_t result;
+
+    if (size < PERF_BENCH_REPORT_SIZE) {
+        return 0;
+    }
+
+    perf_bench_get(&result);
+    buffer[0] = result.tcm_enabled;
+    buffer[1] = result.fused_kernel;
+    buffer[2] = result.valid;
+    ttc_put_u32(&buffer[3], result.inference_min_cycles);
+    ttc_put_u32(&buffer[7], result.inference_avg_cycles);
+    ttc_put_u32(&buffer[11], result.inference_max_cycles);
+    ttc_put_u32(&buffer[15], result.isr_min_cycles);
+    ttc_put_u32(&buffer[19], result.isr_max_cycles);
+    ttc_put_u32(&buffer[23], result.inference_last_cycles);
+    ttc_put_u32(&buffer[27], result.inference_worst_cycles);
+    ttc_put_u32(&buffer[31], result.kernel_min_cycles);
+    ttc_put_u32(&buffer[35], result.kernel_avg_cycles);
+    ttc_put_u32(&buffer[39], result.kernel_max_cycles);
+    ttc_put_u32(&buffer[43], result.kernel_max_ulp);
+
+    return PERF_BENCH_REPORT_SIZE;
+}
@@ -1,83 +1,310 @@
 #include "reset_control.h"
 #include "cmsis_os.h"
+#include "led_control.h"
+#include "system_state.h"
+#include "crash_context.h"
+#include "cycle_counter.h"
+#include "memory_map.h"
+#include "clock_mode.h"
+#include <string.h>
 
 reset_control_t system_reset = {0};
 
+// Hardware sense lines that need debouncing before a reset is committed
+#define RESET_LINE_SOURCES ((1U << RESET_SRC_POWER_SUPERVISOR) | (1U << RESET_SRC_MANUAL))
+
+// MOSFET high-side switches dropped by power-cycling stages
+#define RESET_POWER_SWITCH_PINS (GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3 | GPIO_PIN_4)
+#define RESET_POWER_SWITCH_PORT GPIOA
+
+// Fast WARNING flash from shutdown until the OBC has recovered
+static const led_indication_t reset_indication = {
+    LED_PRIORITY_RESET, LED_MASK(LED_WARNING), 0, LED_MASK(LED_WARNING), 100, NULL,
+};
+
+static const reset_stage_t default_escalation[] = {
+    {100, 0, 0},    // Plain RESET_OUT pulse, as the SN7432N path did
+    {500, 0, 0},    // Longer pulse for an OBC that did not come back
+    {1000, 1, 0},   // Pulse and power cycle the switched rails
+    {1000, 1, 1},   // Power cycle and restart this MCU as well
+};
+
+static reset_stage_t escalation[RESET_MAX_STAGES];
+static uint8_t escalation_count = 0;
+
+static TaskHandle_t reset_task_handle = NULL;
+
+// Written from ISRs and tasks, consumed by the arbiter task
+static volatile uint8_t pending_sources = 0;
+static volatile uint32_t assert_cycles[RESET_SRC_COUNT];
+
+static reset_stats_t reset_stats;
+static uint8_t active_sources = 0;
+static uint32_t last_reset_tick = 0;
+
+static void reset_mark_source(reset_source_t source, uint32_t now) {
+    // Keep the first assertion time so latency covers the whole path
+    if (!(pending_sources & (1U << source))) {
+        assert_cycles[source] = now;
+    }
+    pending_sources |= (uint8_t)(1U << source);
+}
+
+static void reset_sync_legacy_status(uint8_t sources) {
+    system_reset.watchdog_reset = (sources >> RESET_SRC_WATCHDOG) & 1U;
+    system_reset.power_supervisor_reset = (sources >> RESET_SRC_POWER_SUPERVISOR) & 1U;
+    system_reset.software_reset = ((sources >> RESET_SRC_SOFTWARE) |
+                                   (sources >> RESET_SRC_FAULT_HANDLER)) & 1U;
+    system_reset.manual_reset = (sources >> RESET_SRC_MANUAL) & 1U;
+}
+
+static uint8_t reset_line_asserted(reset_source_t source) {
+    // MAX809L RESET and the button are both active low
+    if (source == RESET_SRC_POWER_SUPERVISOR) {
+        return HAL_GPIO_ReadPin(PWR_SUPERVISOR_PORT, PWR_SUPERVISOR_PIN) == GPIO_PIN_RESET;
+    }
+    if (source == RESET_SRC_MANUAL) {
+        return HAL_GPIO_ReadPin(MANUAL_RESET_PORT, MANUAL_RESET_PIN) == GPIO_PIN_RESET;
+    }
+    return 1;
+}
+
+static uint32_t reset_earliest_assertion(uint8_t sources) {
+    uint32_t now = cycle_counter_now();
+    uint32_t oldest_age = 0;
+
+    for (int i = 0; i < RESET_SRC_COUNT; i++) {
+        if (sources & (1U << i)) {
+            uint32_t age = now - assert_cycles[i];
+            if (age > oldest_age) {
+                oldest_age = age;
+            }
+        }
+    }
+
+    return now - oldest_age;
+}
+
 void reset_controller_init(void) {
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
     // Initialize reset control structure
     memset(&system_reset, 0, sizeof(system_reset));
-    
+    memset(&reset_stats, 0, sizeof(reset_stats));
+    pending_sources = 0;
+    active_sources = 0;
+    reset_control_set_escalation(default_escalation,
+                                 sizeof(default_escalation) / sizeof(default_escalation[0]));
+
     // Ensure ML_FAULT and RESET_OUT are initially low
     HAL_GPIO_WritePin(ML_FAULT_PORT, ML_FAULT_PIN, GPIO_PIN_RESET);
     HAL_GPIO_WritePin(RESET_OUT_PORT, RESET_OUT_PIN, GPIO_PIN_RESET);
+
+    // Supervisor and button lines interrupt on assertion (falling edge)
+    GPIO_InitStruct.Pin = PWR_SUPERVISOR_PIN | MANUAL_RESET_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    HAL_GPIO_Init(PWR_SUPERVISOR_PORT, &GPIO_InitStruct);
+
+    HAL_NVIC_SetPriority(EXTI15_10_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
 }
 
-void reset_control_task(void *argument) {
-    // Your existing reset_control_task implementation
-    TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(100); // 10Hz update
-    
-    for(;;) {
-        // Check all reset sources (matches SN7432N inputs)
-        system_reset.watchdog_reset = check_watchdog_timeout();
-        system_reset.power_supervisor_reset = check_power_supervisor();
-        system_reset.software_reset = check_software_reset_request();
-        system_reset.manual_reset = check_manual_reset_button();
-
-        // Emulate SN7432N OR gate logic in software
-        uint8_t combined_reset = system_reset.watchdog_reset ||
-                                system_reset.power_supervisor_reset ||
-                                system_reset.software_reset ||
-                                system_reset.manual_reset;
-
-        if (combined_reset && !system_reset.global_reset_status) {
-            // Signal ML_FAULT to OBC before reset
-            HAL_GPIO_WritePin(ML_FAULT_PORT, ML_FAULT_PIN, GPIO_PIN_SET);
-            
-            // Enter reset pending state
-            current_system_state = SYS_STATE_RESET_PENDING;
-            system_reset.global_reset_status = 1;
-
-            // Execute controlled shutdown
-            execute_controlled_shutdown();
-
-            // Trigger hardware reset
-            HAL_GPIO_WritePin(RESET_OUT_PORT, RESET_OUT_PIN, GPIO_PIN_SET);
-            osDelay(100);
-            HAL_GPIO_WritePin(RESET_OUT_PORT, RESET_OUT_PIN, GPIO_PIN_RESET);
-        }
-        
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+void reset_control_request(reset_source_t source) {
+    uint32_t now = cycle_counter_now();
+
+    if (source >= RESET_SRC_COUNT) {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    reset_mark_source(source, now);
+    taskEXIT_CRITICAL();
+
+    if (reset_task_handle != NULL) {
+        xTaskNotifyGive(reset_task_handle);
     }
 }
 
-uint8_t check_watchdog_timeout(void) {
-    // Check TPL5010 watchdog status
-    return HAL_GPIO_ReadPin(WDOG_DONE_PORT, WDOG_DONE_PIN) == GPIO_PIN_SET;
+ITCM_FUNC void reset_control_request_from_isr(reset_source_t source) {
+    uint32_t now = cycle_counter_now();
+    BaseType_t higher_priority_woken = pdFALSE;
+
+    if (source >= RESET_SRC_COUNT) {
+        return;
+    }
+
+    UBaseType_t saved_mask = taskENTER_CRITICAL_FROM_ISR();
+    reset_mark_source(source, now);
+    taskEXIT_CRITICAL_FROM_ISR(saved_mask);
+
+    // Before the scheduler runs the request stays pending and is picked up
+    // as soon as the arbiter task starts
+    if (reset_task_handle != NULL) {
+        vTaskNotifyGiveFromISR(reset_task_handle, &higher_priority_woken);
+        portYIELD_FROM_ISR(higher_priority_woken);
+    }
 }
 
-uint8_t check_power_supervisor(void) {
-    // Check MAX809L power supervisor
-    // This would typically be connected to a GPIO or ADC
-    return 0; // Placeholder
+void reset_control_set_escalation(const reset_stage_t *stages, uint8_t count) {
+    if (stages == NULL || count == 0) {
+        return;
+    }
+    if (count > RESET_MAX_STAGES) {
+        count = RESET_MAX_STAGES;
+    }
+
+    taskENTER_CRITICAL();
+    memcpy(escalation, stages, count * sizeof(reset_stage_t));
+    escalation_count = count;
+    taskEXIT_CRITICAL();
 }
 
-uint8_t check_software_reset_request(void) {
-    // Check if software reset was requested
-    return system_reset.software_reset;
+void reset_control_get_stats(reset_stats_t *stats) {
+    taskENTER_CRITICAL();
+    *stats = reset_stats;
+    taskEXIT_CRITICAL();
 }
 
-uint8_t check_manual_reset_button(void) {
-    // Check manual reset button (if implemented)
-    return 0; // Placeholder
+void reset_control_task(void *argument) {
+    reset_task_handle = xTaskGetCurrentTaskHandle();
+    reset_stats.state = RESET_STATE_ARMED;
+
+    for(;;) {
+        switch (reset_stats.state) {
+            case RESET_STATE_ARMED:
+                // Block until an ISR or task posts a source - no polling
+                if (pending_sources == 0) {
+                    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                }
+                if (pending_sources != 0) {
+                    // Run the recovery sequence at full speed
+                    clock_mode_request(CLOCK_REASON_RECOVERY);
+                    system_reset.global_reset_status = 1;
+                    reset_stats.state = RESET_STATE_PENDING;
+                }
+                break;
+
+            case RESET_STATE_PENDING: {
+                // Hardware lines must still be asserted after the debounce
+                // time; software sources are taken as they are
+                if (pending_sources & RESET_LINE_SOURCES) {
+                    vTaskDelay(pdMS_TO_TICKS(RESET_DEBOUNCE_MS));
+
+                    taskENTER_CRITICAL();
+                    for (int i = 0; i < RESET_SRC_COUNT; i++) {
+                        if ((RESET_LINE_SOURCES & (1U << i)) && !reset_line_asserted((reset_source_t)i)) {
+                            pending_sources &= (uint8_t)~(1U << i);
+                        }
+                    }
+                    taskEXIT_CRITICAL();
+                }
+
+                taskENTER_CRITICAL();
+                active_sources = pending_sources;
+                taskEXIT_CRITICAL();
+
+                if (active_sources == 0) {
+                    // Glitch on a sense line - nothing to do
+                    system_reset.global_reset_status = 0;
+                    reset_stats.state = RESET_STATE_ARMED;
+                    break;
+                }
+
+                // Escalate when the previous reset did not fix the problem
+                uint32_t now = osKernelGetTickCount();
+                if (reset_stats.reset_count > 0 &&
+                    (now - last_reset_tick) < pdMS_TO_TICKS(RESET_ESCALATION_WINDOW_MS)) {
+                    if (reset_stats.escalation_level + 1 < escalation_count) {
+                        reset_stats.escalation_level++;
+                    }
+                } else {
+                    reset_stats.escalation_level = 0;
+                }
+
+                reset_stats.last_sources = active_sources;
+                reset_sync_legacy_status(active_sources);
+                reset_stats.state = RESET_STATE_SHUTTING_DOWN;
+                break;
+            }
+
+            case RESET_STATE_SHUTTING_DOWN:
+                // Signal ML_FAULT to OBC before reset
+                HAL_GPIO_WritePin(ML_FAULT_PORT, ML_FAULT_PIN, GPIO_PIN_SET);
+                update_system_state(SYS_STATE_RESET_PENDING);
+
+                execute_controlled_shutdown();
+
+                // Leave the cause behind in case the reset takes us down too
+                crash_context_note_reset(CRASH_REASON_RESET_REQUEST, active_sources);
+                reset_stats.state = RESET_STATE_ASSERTED;
+                break;
+
+            case RESET_STATE_ASSERTED: {
+                const reset_stage_t *stage = &escalation[reset_stats.escalation_level];
+
+                if (stage->power_cycle) {
+                    HAL_GPIO_WritePin(RESET_POWER_SWITCH_PORT, RESET_POWER_SWITCH_PINS, GPIO_PIN_RESET);
+                }
+
+                HAL_GPIO_WritePin(RESET_OUT_PORT, RESET_OUT_PIN, GPIO_PIN_SET);
+                uint32_t asserted_at = cycle_counter_now();
+
+                uint32_t latency = asserted_at - reset_earliest_assertion(active_sources);
+                reset_stats.last_latency_cycles = latency;
+                reset_stats.last_latency_us = CYCLES_TO_US(latency);
+                if (latency > reset_stats.worst_latency_cycles) {
+                    reset_stats.worst_latency_cycles = latency;
+                }
+
+                osDelay(stage->pulse_ms);
+                HAL_GPIO_WritePin(RESET_OUT_PORT, RESET_OUT_PIN, GPIO_PIN_RESET);
+
+                if (stage->power_cycle) {
+                    HAL_GPIO_WritePin(RESET_POWER_SWITCH_PORT, RESET_POWER_SWITCH_PINS, GPIO_PIN_SET);
+                }
+
+                if (stage->self_reset) {
+                    // Reason already recorded during shutdown
+                    NVIC_SystemReset();
+                }
+
+                reset_stats.reset_count++;
+                last_reset_tick = osKernelGetTickCount();
+                reset_stats.state = RESET_STATE_RECOVERED;
+                break;
+            }
+
+            case RESET_STATE_RECOVERED:
+                // Give the OBC time to boot before accepting new requests
+                osDelay(RESET_RECOVERY_HOLDOFF_MS);
+
+                taskENTER_CRITICAL();
+                pending_sources &= (uint8_t)~active_sources;
+                taskEXIT_CRITICAL();
+                active_sources = 0;
+
+                HAL_GPIO_WritePin(ML_FAULT_PORT, ML_FAULT_PIN, GPIO_PIN_RESET);
+                led_compositor_clear(LED_SOURCE_RESET);
+                reset_sync_legacy_status(0);
+                system_reset.global_reset_status = 0;
+                update_system_state(SYS_STATE_NORMAL);
+                reset_stats.state = RESET_STATE_ARMED;
+                break;
+
+            default:
+                reset_stats.state = RESET_STATE_ARMED;
+                break;
+        }
+    }
 }
 
 void execute_controlled_shutdown(void) {
     // Save critical data to non-volatile memory
     // Close communication channels
     // Set all outputs to safe states
-    
+
     // Flash warning LED
-    set_led_blink_rate(LED_WARNING, 100);
+    led_compositor_post(LED_SOURCE_RESET, &reset_indication, 0);
     osDelay(500);
-}
\ No newline at end of file
+}
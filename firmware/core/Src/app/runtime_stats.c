@@ -0,0 +1,185 @@
+#include "runtime_stats.h"
+#include "cycle_counter.h"
+#include "cmsis_os.h"
+#include "memory_map.h"
+#include "ttc_communication.h"
+#include <string.h>
+
+// 64-bit extension of DWT->CYCCNT. The kernel reads the counter on every
+// context switch, far more often than the ~15.6 s CYCCNT wrap.
+static uint64_t extended_cycles = 0;
+static uint32_t last_cyccnt = 0;
+
+static TaskStatus_t task_status[RUNTIME_STATS_MAX_TASKS];
+static uint32_t prev_runtime[RUNTIME_STATS_MAX_TASKS];
+static UBaseType_t prev_number[RUNTIME_STATS_MAX_TASKS];
+static uint8_t prev_count = 0;
+static uint32_t prev_total = 0;
+
+static runtime_stats_task_t task_stats[RUNTIME_STATS_MAX_TASKS];
+static uint8_t task_count = 0;
+static uint16_t cpu_load_permille = 0;
+static uint32_t min_stack_free = 0;
+
+void runtime_stats_timer_init(void) {
+    cycle_counter_init();
+    extended_cycles = 0;
+    last_cyccnt = cycle_counter_now();
+}
+
+// Called on every context switch
+ITCM_FUNC uint32_t runtime_stats_counter(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = cycle_counter_now();
+    extended_cycles += (uint32_t)(now - last_cyccnt);
+    last_cyccnt = now;
+    uint32_t value = (uint32_t)(extended_cycles >> RUNTIME_STATS_CLOCK_SHIFT);
+
+    __set_PRIMASK(primask);
+    return value;
+}
+
+// Cycles the counter missed while the core slept (see low_power.c); the
+// idle task was running, so they go to its share
+void runtime_stats_account_sleep(uint64_t cycles) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    extended_cycles += cycles;
+
+    __set_PRIMASK(primask);
+}
+
+static uint32_t previous_runtime_of(UBaseType_t task_number) {
+    for (int i = 0; i < prev_count; i++) {
+        if (prev_number[i] == task_number) {
+            return prev_runtime[i];
+        }
+    }
+    // New task: its whole run time falls into this window
+    return 0;
+}
+
+void runtime_stats_sample(void) {
+    uint32_t total = 0;
+    UBaseType_t count = uxTaskGetSystemState(task_status, RUNTIME_STATS_MAX_TASKS, &total);
+    uint32_t window = total - prev_total;
+
+    if (count == 0 || window == 0) {
+        return;
+    }
+
+    TaskHandle_t idle = xTaskGetIdleTaskHandle();
+    uint16_t idle_permille = 0;
+    uint32_t stack_floor = UINT32_MAX;
+    runtime_stats_task_t sampled[RUNTIME_STATS_MAX_TASKS];
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        TaskStatus_t *status = &task_status[i];
+        uint32_t delta = status->ulRunTimeCounter - previous_runtime_of(status->xTaskNumber);
+        uint16_t permille = (uint16_t)(((uint64_t)delta * 1000U) / window);
+        uint32_t stack_free = (uint32_t)status->usStackHighWaterMark * sizeof(StackType_t);
+
+        if (permille > 1000) {
+            permille = 1000;
+        }
+        if (status->xHandle == idle) {
+            idle_permille = permille;
+        }
+        if (stack_free < stack_floor) {
+            stack_floor = stack_free;
+        }
+
+        sampled[i].name = status->pcTaskName;
+        sampled[i].task_number = (uint8_t)status->xTaskNumber;
+        sampled[i].cpu_permille = permille;
+        sampled[i].stack_free_bytes = stack_free;
+    }
+
+    // Keep run time totals for the next window
+    for (UBaseType_t i = 0; i < count; i++) {
+        prev_number[i] = task_status[i].xTaskNumber;
+        prev_runtime[i] = task_status[i].ulRunTimeCounter;
+    }
+    prev_count = (uint8_t)count;
+    prev_total = total;
+
+    taskENTER_CRITICAL();
+    memcpy(task_stats, sampled, count * sizeof(runtime_stats_task_t));
+    task_count = (uint8_t)count;
+    cpu_load_permille = 1000 - idle_permille;
+    min_stack_free = stack_floor;
+    taskEXIT_CRITICAL();
+}
+
+uint8_t runtime_stats_get_task(uint8_t index, runtime_stats_task_t *task) {
+    uint8_t valid = 0;
+
+    taskENTER_CRITICAL();
+    if (index < task_count) {
+        *task = task_stats[index];
+        valid = 1;
+    }
+    taskEXIT_CRITICAL();
+
+    return valid;
+}
+
+uint8_t runtime_stats_task_count(void) {
+    return task_count;
+}
+
+uint32_t runtime_stats_min_stack_free(void) {
+    return min_stack_free;
+}
+
+float get_cpu_usage_percent(void) {
+    // Everything that was not the idle task during the last window
+    return (float)cpu_load_permille / 10.0f;
+}
+
+float get_memory_usage_percent(void) {
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+    // FreeRTOS heap_4 usage
+    size_t free_heap = xPortGetFreeHeapSize();
+    size_t total_heap = configTOTAL_HEAP_SIZE;
+
+    return ((float)(total_heap - free_heap) / (float)total_heap) * 100.0f;
+#else
+    // No heap in flight builds
+    return 0.0f;
+#endif
+}
+
+uint16_t runtime_stats_build_report(uint8_t *buffer, uint16_t size) {
+    runtime_stats_task_t task;
+    uint16_t length = RUNTIME_STATS_REPORT_HEADER_SIZE;
+
+    if (size < RUNTIME_STATS_REPORT_HEADER_SIZE) {
+        return 0;
+    }
+
+    ttc_put_u16(&buffer[0], cpu_load_permille);
+    buffer[2] = (uint8_t)get_memory_usage_percent();
+    buffer[3] = 0;
+
+    for (uint8_t i = 0; runtime_stats_get_task(i, &task); i++) {
+        if (length + RUNTIME_STATS_REPORT_ENTRY_SIZE > size) {
+            break;
+        }
+
+        uint8_t *record = &buffer[length];
+        record[0] = task.task_number;
+        ttc_put_u16(&record[1], task.cpu_permille);
+        ttc_put_u16(&record[3], task.stack_free_bytes);
+        memset(&record[5], 0, RUNTIME_STATS_NAME_LEN);
+        memcpy(&record[5], task.name, strnlen(task.name, RUNTIME_STATS_NAME_LEN));
+
+        length += RUNTIME_STATS_REPORT_ENTRY_SIZE;
+        buffer[3]++;
+    }
+
+    return length;
+}
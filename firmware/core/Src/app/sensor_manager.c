@@ -93,6 +93,30 @@ float read_internal_temperature(void) {
     return temperature;
 }
 
+// Analog supply from VREFINT against its factory calibration (taken at
+// VDDA = 3.3 V, 16-bit). Used by the self test as an ADC sanity check;
+// the caller holds ml_pipeline_lock.
+uint32_t read_vdda_mv(void) {
+    ADC_ChannelConfTypeDef sConfig = {0};
+    sConfig.Channel = ADC_CHANNEL_VREFINT;
+    sConfig.Rank = ADC_REGULAR_RANK_1;
+    sConfig.SamplingTime = ADC_SAMPLETIME_387CYCLES_5;
+    HAL_ADC_ConfigChannel(&hadc1, &sConfig);
+
+    HAL_ADC_Start(&hadc1);
+    if (HAL_ADC_PollForConversion(&hadc1, 10) != HAL_OK) {
+        HAL_ADC_Stop(&hadc1);
+        return 0;
+    }
+    uint32_t raw_value = HAL_ADC_GetValue(&hadc1);
+    HAL_ADC_Stop(&hadc1);
+
+    if (raw_value == 0) {
+        return 0;
+    }
+    return __HAL_ADC_CALC_VREFANALOG_VOLTAGE(raw_value, ADC_RESOLUTION_16B);
+}
+
 float read_vdd_voltage(void) {
     // Read internal VREF to calculate VDD
     // This is a simplified implementation
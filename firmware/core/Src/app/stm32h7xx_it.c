@@ -24,6 +24,9 @@
 #include "task.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "crash_context.h"
+#include "low_power.h"
+#include "fast_rules.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -48,6 +51,8 @@
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN PFP */
+// Naked so the stacked exception frame is located before any prologue runs
+void HardFault_Handler(void) __attribute__((naked));
 
 /* USER CODE END PFP */
 
@@ -88,6 +93,15 @@ void NMI_Handler(void)
 void HardFault_Handler(void)
 {
   /* USER CODE BEGIN HardFault_IRQn 0 */
+  // Pass the active stack pointer (MSP or PSP per EXC_RETURN bit 2) to the
+  // capture routine, which stores the frame in retained RAM and resets
+  __asm volatile(
+    "tst lr, #4                          \n"
+    "ite eq                              \n"
+    "mrseq r0, msp                       \n"
+    "mrsne r0, psp                       \n"
+    "b crash_context_capture_hardfault   \n"
+  );
 
   /* USER CODE END HardFault_IRQn 0 */
   while (1)
@@ -255,5 +269,33 @@ void USART1_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles EXTI line[15:10] interrupts.
+  */
+void EXTI15_10_IRQHandler(void)
+{
+  // PA11 power supervisor, PA12 manual reset, PC13 OBC heartbeat
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_11);
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_12);
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_13);
+}
+
+/**
+  * @brief This function handles LPTIM1 global interrupt.
+  */
+void LPTIM1_IRQHandler(void)
+{
+  // Tickless idle wake-up
+  low_power_lptim_irq();
+}
+
+/**
+  * @brief This function handles LPTIM2 global interrupt.
+  */
+void LPTIM2_IRQHandler(void)
+{
+  // OBC heartbeat deadline
+  fast_rules_lptim_irq();
+}
 
 /* USER CODE END 1 */
@@ -1,41 +1,42 @@
 #include "main.h"
+#include "cmsis_os.h"
 #include "led_control.h"
-#include "reset_control.h"
-
+#include "system_init.h"
+#include "system_state.h"
+#include "system_test.h"
+#include "boot_timeline.h"
+#include "low_power.h"
+#include "fast_rules.h"
+
+// Last thing main() runs before the scheduler. Nothing here may block:
+// osDelay is not available yet and every millisecond delays detection.
 void system_startup_sequence(void) {
-    // Boot sequence with LED diagnostics
-    ws2812b_chase_pattern(COLOR_BOOT);
-
-    // Step 1: MCU initialization (done by CubeMX)
-    set_led_blink_rate(LED_SYS_OK, 500);
-
-    // Step 2: Reset circuit initialization
-    reset_controller_init();
-
-    // Step 3: Peripheral initialization
-    enter_diagnostic_mode();
+    // Boot sequence with LED diagnostics, rendered by led_controller_task
+    // once the scheduler runs
+    led_compositor_post(LED_SOURCE_BOOT, &led_indication_boot, LED_BOOT_INDICATION_MS);
 
-    // Step 4: ML model loading
-    set_led(LED_ML_ACTIVE, 1);
-    load_ml_model();
-    set_led(LED_ML_ACTIVE, 0);
-
-    // Step 5: System ready - start autonomous monitoring
-    set_led(LED_SYS_OK, 1);
-    ws2812b_set_color(COLOR_NORMAL);
+    // ML model loading, self test and the LSE start-up continue
+    // concurrently in ml_inference_task and boot_task
+    boot_timeline_mark(BOOT_STEP_SUBSYSTEMS);
 }
 
-void enter_diagnostic_mode(void) {
-    // Flash all LEDs in sequence for diagnostic
-    for(int i = 0; i < LED_COUNT; i++) {
-        set_led(i, 1);
-        osDelay(200);
-        set_led(i, 0);
+// Startup work nothing time-critical depends on. Runs below the
+// monitoring tasks and exits when done.
+void boot_task(void *argument) {
+    // LSE start-up takes up to LOW_POWER_LSE_TIMEOUT_MS; the idle task
+    // only sleeps once LPTIM1 is calibrated
+    boot_timeline_wait(BOOT_STEP_LOW_POWER, osWaitForever);
+    low_power_init();
+    fast_rules_init();
+    boot_timeline_mark(BOOT_STEP_LOW_POWER);
+
+    boot_timeline_wait(BOOT_STEP_SELF_TEST, BOOT_SELF_TEST_WAIT_MS);
+    if (run_system_self_test()) {
+        boot_timeline_mark(BOOT_STEP_SELF_TEST);
+    } else {
+        boot_timeline_fail(BOOT_STEP_SELF_TEST);
+        update_system_state(SYS_STATE_WARNING);
     }
-}
 
-void load_ml_model(void) {
-    // Load ML model - implementation depends on STM32Cube.AI
-    // ai_system_configure();
-    osDelay(1000); // Simulate loading time
-}
\ No newline at end of file
+    osThreadExit();
+}
@@ -1,43 +1,74 @@
 #include "system_state.h"
+#include "led_control.h"
 #include "cmsis_os.h"
 
 // Global system state
 system_state_t current_system_state = SYS_STATE_BOOT;
 
+static const led_animation_t rgb_ml_active = {
+    .effect = LED_EFFECT_BLINK, .color = {0, 0, 255}, .period_ms = 1000,
+};
+static const led_animation_t rgb_warning = {
+    .effect = LED_EFFECT_BLINK, .color = {255, 255, 0}, .period_ms = 250,
+};
+static const led_animation_t rgb_degradation = {
+    .effect = LED_EFFECT_SOLID, .color = {255, 165, 0}, .period_ms = 1000,
+};
+static const led_animation_t rgb_critical = {
+    .effect = LED_EFFECT_BLINK, .color = {255, 0, 0}, .period_ms = 200,
+};
+static const led_animation_t rgb_demo = {
+    .effect = LED_EFFECT_BREATHE, .color = {0, 255, 255}, .period_ms = 2000, .led_phase = 85,
+};
+static const led_animation_t rgb_reset_pending = {
+    .effect = LED_EFFECT_BLINK, .color = {255, 255, 255}, .period_ms = 200,
+};
+
+// Background indication of every state, lowest compositor priority
+static const led_indication_t state_indications[SYS_STATE_COUNT] = {
+    // Chase pattern, SYS_OK blinking until boot completes
+    [SYS_STATE_BOOT] = {LED_PRIORITY_STATE, LED_MASK_ALL, 0, LED_MASK(LED_SYS_OK), 500,
+                        &led_animation_boot},
+    // Solid green
+    [SYS_STATE_NORMAL] = {LED_PRIORITY_STATE, LED_MASK_ALL, LED_MASK(LED_SYS_OK), 0, 0,
+                          &led_animation_normal},
+    // Blue blink
+    [SYS_STATE_ML_ACTIVE] = {LED_PRIORITY_STATE, LED_MASK_ALL,
+                             LED_MASK(LED_SYS_OK) | LED_MASK(LED_ML_ACTIVE), 0, 0, &rgb_ml_active},
+    [SYS_STATE_DATA_COLLECTION] = {LED_PRIORITY_STATE, LED_MASK_ALL,
+                                   LED_MASK(LED_SYS_OK) | LED_MASK(LED_COMM_ACTIVE), 0, 0,
+                                   &led_animation_normal},
+    // Yellow fast blink
+    [SYS_STATE_WARNING] = {LED_PRIORITY_STATE, LED_MASK_ALL, LED_MASK(LED_SYS_OK),
+                           LED_MASK(LED_WARNING), 250, &rgb_warning},
+    [SYS_STATE_OBC_DEGRADATION] = {LED_PRIORITY_STATE, LED_MASK_ALL, LED_MASK(LED_WARNING), 0, 0,
+                                   &rgb_degradation},
+    // Red solid
+    [SYS_STATE_OBC_FAULT] = {LED_PRIORITY_STATE, LED_MASK_ALL, LED_MASK(LED_FAULT_DBC), 0, 0,
+                             &rgb_obc_fault},
+    // Purple solid
+    [SYS_STATE_TTC_FAULT] = {LED_PRIORITY_STATE, LED_MASK_ALL, LED_MASK(LED_FAULT_TTC), 0, 0,
+                             &rgb_ttc_fault},
+    // Red fast blink
+    [SYS_STATE_CRITICAL] = {LED_PRIORITY_STATE, LED_MASK_ALL, 0,
+                            LED_MASK(LED_FAULT_DBC) | LED_MASK(LED_FAULT_TTC), 100, &rgb_critical},
+    [SYS_STATE_DEMO] = {LED_PRIORITY_STATE, LED_MASK_ALL, LED_MASK(LED_SYS_OK), 0, 0, &rgb_demo},
+    // All LEDs blink rapidly
+    [SYS_STATE_RESET_PENDING] = {LED_PRIORITY_STATE, LED_MASK_ALL, 0, LED_MASK_ALL, 100,
+                                 &rgb_reset_pending},
+};
+
 void update_system_state(system_state_t new_state) {
-    current_system_state = new_state;
-    
-    // Update LEDs based on new state
-    switch(new_state) {
-        case SYS_STATE_BOOT:
-            // Chase pattern handled in startup sequence
-            break;
-        case SYS_STATE_NORMAL:
-            // Solid green
-            break;
-        case SYS_STATE_ML_ACTIVE:
-            // Blue blink
-            break;
-        case SYS_STATE_WARNING:
-            // Yellow fast blink
-            break;
-        case SYS_STATE_OBC_FAULT:
-            // Red solid
-            break;
-        case SYS_STATE_TTC_FAULT:
-            // Purple solid
-            break;
-        case SYS_STATE_CRITICAL:
-            // Red fast blink
-            break;
-        case SYS_STATE_RESET_PENDING:
-            // All LEDs blink rapidly
-            break;
-        default:
-            break;
+    if (new_state >= SYS_STATE_COUNT) {
+        return;
     }
+
+    current_system_state = new_state;
+
+    // Rendered by led_controller_task; higher layers (ML, reset) still win
+    led_compositor_post(LED_SOURCE_SYSTEM_STATE, &state_indications[new_state], 0);
 }
 
 system_state_t get_current_system_state(void) {
     return current_system_state;
-}
\ No newline at end of file
+}
@@ -1,64 +1,40 @@
 #include "system_test.h"
 #include "led_control.h"
 #include "reset_control.h"
-#include "ttc_communication.h"
 #include "fault_detection.h"
+#include "bist.h"
 #include "cmsis_os.h"
 
-void run_system_self_test(void) {
-    // Comprehensive system self-test
-    set_led(LED_SYS_OK, 0); // Turn off SYS_OK during test
-    
-    test_led_system();
-    HAL_Delay(1000);  // Use HAL_Delay instead of osDelay (RTOS not started yet)
-    
-    test_communication_system();
-    HAL_Delay(1000);
-    
-    test_ml_system();
-    HAL_Delay(1000);
-    
-    // If all tests pass
-    set_led(LED_SYS_OK, 1);
-    // Note: ws2812b_set_color might not work until RTOS starts
+// Shows one self test pattern on the boot layer; state and fault layers
+// above it are left alone
+static void self_test_show(uint8_t on_mask, uint32_t duration_ms) {
+    const led_indication_t pattern = {
+        LED_PRIORITY_BOOT, LED_MASK_ALL, on_mask, 0, 0, &led_animation_boot,
+    };
+
+    led_compositor_post(LED_SOURCE_BOOT, &pattern, duration_ms);
+    osDelay(duration_ms);
 }
 
-void test_led_system(void) {
-    // Test individual LEDs
-    for(int i = 0; i < LED_COUNT; i++) {
-        set_led(i, 1);
-        osDelay(200);
-        set_led(i, 0);
+// Runs in boot_task alongside the monitoring tasks; the BIST takes the
+// locks for what they share. Returns 1 when no test failed.
+uint8_t run_system_self_test(void) {
+    uint8_t passed = test_led_system();
+
+    if (!bist_run(BIST_TRIGGER_BOOT, BIST_ALL_TESTS)) {
+        passed = 0;
     }
-    
-    // Test RGB LED
-    ws2812b_set_color(COLOR_BOOT);
-    osDelay(500);
-    ws2812b_set_color(COLOR_NORMAL);
-}
 
-void test_communication_system(void) {
-    // Test UART communication
-    uint8_t test_data[] = "SELF_TEST";
-    ttc_transmit_data(test_data, sizeof(test_data) - 1);
-    
-    set_led(LED_COMM_ACTIVE, 1);
-    osDelay(500);
-    set_led(LED_COMM_ACTIVE, 0);
+    return passed;
 }
 
-void test_ml_system(void) {
-    // Test ML system initialization
-    ml_model_t test_model;
-    if (ml_model_init(&test_model)) {
-        set_led(LED_ML_ACTIVE, 1);
-        osDelay(500);
-        set_led(LED_ML_ACTIVE, 0);
-        ml_model_deinit(&test_model);
-    } else {
-        // ML test failed
-        set_led(LED_FAULT_DBC, 1);
+uint8_t test_led_system(void) {
+    // Test individual LEDs; the RGB test is part of led_animation_boot
+    for(int i = 0; i < LED_COUNT; i++) {
+        self_test_show(LED_MASK(i), 200);
     }
+
+    return 1;
 }
 
 void test_fault_detection(void) {
@@ -71,4 +47,4 @@ void test_fault_detection(void) {
     
     // This should trigger LED changes and potentially reset
     handle_detected_fault(&test_fault);
-}
\ No newline at end of file
+}
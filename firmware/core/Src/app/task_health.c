@@ -0,0 +1,117 @@
+#include "task_health.h"
+#include "cmsis_os.h"
+#include "ttc_communication.h"
+
+static task_health_entry_t health_table[TASK_HEALTH_COUNT] = {
+    [TASK_HEALTH_ML_INFERENCE] = {.name = "MLInference", .deadline_ms = TASK_HEALTH_ML_DEADLINE_MS},
+    [TASK_HEALTH_FAULT_HANDLER] = {.name = "FaultHandler", .deadline_ms = TASK_HEALTH_FAULT_DEADLINE_MS},
+    [TASK_HEALTH_TTC_MONITOR] = {.name = "TTCMonitor", .deadline_ms = TASK_HEALTH_TTC_DEADLINE_MS},
+};
+
+void task_health_init(void) {
+    uint32_t now = osKernelGetTickCount();
+
+    // Start every deadline from now so tasks get one full period to come up
+    for (int i = 0; i < TASK_HEALTH_COUNT; i++) {
+        health_table[i].last_checkin = now;
+        health_table[i].last_period_ms = 0;
+        health_table[i].worst_period_ms = 0;
+        health_table[i].checkins = 0;
+        health_table[i].deadline_misses = 0;
+        health_table[i].stale = 0;
+    }
+}
+
+void task_health_checkin(task_health_id_t id) {
+    if (id >= TASK_HEALTH_COUNT) {
+        return;
+    }
+
+    uint32_t now = osKernelGetTickCount();
+    task_health_entry_t *entry = &health_table[id];
+
+    taskENTER_CRITICAL();
+    // The first period includes task start-up, so it is not a loop period
+    if (entry->checkins > 0) {
+        int32_t ticks = (int32_t)(now - entry->last_checkin);
+        uint32_t period = (ticks > 0) ? (uint32_t)ticks * portTICK_PERIOD_MS : 0;
+        entry->last_period_ms = period;
+        if (period > entry->worst_period_ms) {
+            entry->worst_period_ms = period;
+        }
+    }
+    entry->last_checkin = now;
+    entry->checkins++;
+    taskEXIT_CRITICAL();
+}
+
+// Every deadline moves on by ticks in which no task could run, ahead of
+// the tick count catching up on them
+void task_health_excuse(uint32_t ticks) {
+    taskENTER_CRITICAL();
+    for (int i = 0; i < TASK_HEALTH_COUNT; i++) {
+        health_table[i].last_checkin += ticks;
+    }
+    taskEXIT_CRITICAL();
+}
+
+uint8_t task_health_all_fresh(uint8_t *stale_mask) {
+    uint32_t now = osKernelGetTickCount();
+    uint8_t mask = 0;
+
+    taskENTER_CRITICAL();
+    for (int i = 0; i < TASK_HEALTH_COUNT; i++) {
+        task_health_entry_t *entry = &health_table[i];
+
+        // Signed: an excused check-in is ahead of now until the tick
+        // count has caught up
+        if ((int32_t)(now - entry->last_checkin) > (int32_t)pdMS_TO_TICKS(entry->deadline_ms)) {
+            if (entry->deadline_misses < UINT16_MAX) {
+                entry->deadline_misses++;
+            }
+            entry->stale = 1;
+            mask |= (uint8_t)(1U << i);
+        } else {
+            entry->stale = 0;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (stale_mask != NULL) {
+        *stale_mask = mask;
+    }
+    return mask == 0;
+}
+
+void task_health_get(task_health_id_t id, task_health_entry_t *entry) {
+    if (id >= TASK_HEALTH_COUNT) {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    *entry = health_table[id];
+    taskEXIT_CRITICAL();
+}
+
+uint16_t task_health_build_report(uint8_t *buffer, uint16_t size) {
+    uint16_t length = 0;
+    task_health_entry_t entry;
+
+    for (int i = 0; i < TASK_HEALTH_COUNT; i++) {
+        if (length + TASK_HEALTH_REPORT_ENTRY_SIZE > size) {
+            break;
+        }
+
+        task_health_get((task_health_id_t)i, &entry);
+
+        uint8_t *record = &buffer[length];
+        record[0] = (uint8_t)i;
+        record[1] = entry.stale;
+        ttc_put_u16(&record[2], entry.last_period_ms);
+        ttc_put_u16(&record[4], entry.worst_period_ms);
+        ttc_put_u16(&record[6], entry.deadline_misses);
+        length += TASK_HEALTH_REPORT_ENTRY_SIZE;
+    }
+
+    return length;
+}
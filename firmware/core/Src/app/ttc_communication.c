@@ -1,17 +1,99 @@
 #include "ttc_communication.h"
 #include "string.h"
 #include "cmsis_os.h"
+#include "blackbox.h"
+#include "crash_context.h"
+#include "task_health.h"
+#include "runtime_stats.h"
+#include "perf_bench.h"
+#include "ml_cascade.h"
+#include "novelty_monitor.h"
+#include "memory_map.h"
+#include "low_power.h"
+#include "clock_mode.h"
+#include "boot_timeline.h"
+#include "bist.h"
+#include "model_update.h"
+#include "ml_adaptation.h"
+#include "fast_rules.h"
+#include "ml_cache.h"
+#include "ml_integration.h"
 
-static ttc_handle_t ttc_handle;
+// UART buffers are DMA-ready; ttc_communication_init clears them
+static ttc_handle_t ttc_handle DMA_BUFFER;
 extern UART_HandleTypeDef huart1;
 
+// Uplink frames with a good CRC since boot. Kept out of ttc_handle so a
+// link restart never rewinds it: the feature engine counts frames as the
+// difference of two readings.
+static uint32_t frames_received;
+
+// Link recovery the fault handler asked for, carried out by
+// ttc_monitor_task so nothing else touches USART1 meanwhile
+#define TTC_RECOVER_RESTART 0x01
+#define TTC_RECOVER_RETRANSMIT 0x02
+static volatile uint8_t recovery_pending;
+
+static void restart_uart_link(void);
+static void request_data_retransmission(void);
+
+typedef enum {
+    UPLINK_WAIT_SYNC = 0,
+    UPLINK_WAIT_ID,
+    UPLINK_WAIT_LENGTH,
+    UPLINK_PAYLOAD,
+    UPLINK_WAIT_CRC
+} uplink_state_t;
+
+// Uplink frame being assembled by ttc_process_uplink
+static struct {
+    uplink_state_t state;
+    uint8_t header[2];          // id, length - start of the CRC span
+    uint8_t payload[TTC_UPLINK_MAX_PAYLOAD];
+    uint8_t received;
+} uplink;
+
+static void ttc_start_reception(void) {
+    // USART1 runs from HSI so it keeps receiving in STOP and wakes the
+    // core on the first byte - tickless idle must not drop uplink data
+    UART_WakeUpTypeDef wakeup = {0};
+    wakeup.WakeUpEvent = UART_WAKEUP_ON_READDATA_NONEMPTY;
+    HAL_UARTEx_StopModeWakeUpSourceConfig(&huart1, wakeup);
+    HAL_UARTEx_EnableStopMode(&huart1);
+
+    // Hardware receiver timeout after TTC_TIMEOUT_MS of silence, counted by
+    // fast_rules from the error callback. In STOP the kernel clock only
+    // runs while a frame arrives, so a silent link during a long sleep is
+    // left to ttc_check_connection.
+    HAL_UART_ReceiverTimeout_Config(&huart1, (huart1.Init.BaudRate / 1000U) * FAST_RULE_UART_TIMEOUT_MS);
+    HAL_UART_EnableReceiverTimeout(&huart1);
+    
+    // Start UART reception
+    HAL_UART_Receive_IT(&huart1, &ttc_handle.rx_buffer[ttc_handle.rx_index], 1);
+}
+
+// Once, from ttc_monitor_task before the RX interrupt is armed
 void ttc_communication_init(void) {
     memset(&ttc_handle, 0, sizeof(ttc_handle_t));
+    memset(&uplink, 0, sizeof(uplink));
     ttc_handle.last_rx_time = osKernelGetTickCount();
     ttc_handle.connection_healthy = 1;
-    
-    // Start UART reception
-    HAL_UART_Receive_IT(&huart1, ttc_handle.rx_buffer, 1);
+
+    ttc_start_reception();
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
+    ttc_receive_callback(huart);
+}
+
+// Line errors and the receiver timeout end up here. The timeout and an
+// overrun stop the reception, so it is restarted; after a line error it
+// is still running and this is a no-op.
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+    if (huart->Instance == USART1) {
+        fast_rules_uart_error_from_isr(huart->ErrorCode);
+        HAL_UART_Receive_IT(&huart1, &ttc_handle.rx_buffer[ttc_handle.rx_index], 1);
+    }
 }
 
 void ttc_receive_callback(UART_HandleTypeDef *huart) {
@@ -40,6 +122,212 @@ void ttc_transmit_data(uint8_t *data, uint16_t length) {
     HAL_UART_Transmit(&huart1, ttc_handle.tx_buffer, length, 1000);
 }
 
+static uint8_t ttc_crc8_update(uint8_t crc, const uint8_t *data, uint16_t length) {
+    // CRC-8 (polynomial 0x07, initial value 0), covers frame id, length
+    // and payload
+    for (uint16_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+static void ttc_handle_command(uint8_t command, const uint8_t *payload, uint8_t length) {
+    switch (command) {
+        case TTC_CMD_RUN_BIST:
+            bist_run(BIST_TRIGGER_COMMAND, length > 0 ? payload[0] : BIST_ALL_TESTS);
+            ttc_send_report(TTC_FRAME_BIST_REPORT, bist_build_report);
+            break;
+
+        case TTC_CMD_MODEL_BEGIN:
+            model_update_begin(payload, length);
+            // The slot erase holds this task for a while
+            task_health_checkin(TASK_HEALTH_TTC_MONITOR);
+            ttc_send_report(TTC_FRAME_MODEL_UPDATE, model_update_build_report);
+            break;
+
+        case TTC_CMD_MODEL_CHUNK:
+            model_update_chunk(payload, length);
+            ttc_send_report(TTC_FRAME_MODEL_UPDATE, model_update_build_report);
+            break;
+
+        case TTC_CMD_MODEL_COMMIT:
+            model_update_commit();
+            ttc_send_report(TTC_FRAME_MODEL_UPDATE, model_update_build_report);
+            break;
+
+        case TTC_CMD_MODEL_ROLLBACK:
+            model_update_rollback();
+            ttc_send_report(TTC_FRAME_MODEL_UPDATE, model_update_build_report);
+            break;
+
+        case TTC_CMD_FAULT_LABEL:
+            ml_adaptation_label(payload, length);
+            ttc_send_report(TTC_FRAME_ML_ADAPTATION, ml_adaptation_build_report);
+            break;
+
+        case TTC_CMD_ADAPT_CONTROL:
+            ml_adaptation_control(payload, length);
+            ttc_send_report(TTC_FRAME_ML_ADAPTATION, ml_adaptation_build_report);
+            break;
+
+        default:
+            // Unknown commands are dropped; the ground sees no reply
+            break;
+    }
+}
+
+// Uplink frames: [sync][command][length][payload...][crc8], the CRC over
+// command, length and payload as on the downlink
+void ttc_process_uplink(void) {
+    uint16_t head = ttc_handle.rx_index;
+
+    while (ttc_handle.rx_read_index != head) {
+        uint8_t byte = ttc_handle.rx_buffer[ttc_handle.rx_read_index];
+        ttc_handle.rx_read_index = (uint16_t)((ttc_handle.rx_read_index + 1) % TTC_BUFFER_SIZE);
+
+        switch (uplink.state) {
+            case UPLINK_WAIT_SYNC:
+                if (byte == TTC_SYNC_BYTE) {
+                    uplink.state = UPLINK_WAIT_ID;
+                }
+                break;
+
+            case UPLINK_WAIT_ID:
+                uplink.header[0] = byte;
+                uplink.state = (byte < 0x80) ? UPLINK_WAIT_LENGTH : UPLINK_WAIT_SYNC;
+                break;
+
+            case UPLINK_WAIT_LENGTH:
+                uplink.header[1] = byte;
+                uplink.received = 0;
+                if (byte > TTC_UPLINK_MAX_PAYLOAD) {
+                    uplink.state = UPLINK_WAIT_SYNC;
+                } else {
+                    uplink.state = (byte == 0) ? UPLINK_WAIT_CRC : UPLINK_PAYLOAD;
+                }
+                break;
+
+            case UPLINK_PAYLOAD:
+                uplink.payload[uplink.received++] = byte;
+                if (uplink.received == uplink.header[1]) {
+                    uplink.state = UPLINK_WAIT_CRC;
+                }
+                break;
+
+            case UPLINK_WAIT_CRC: {
+                uint8_t crc = ttc_crc8_update(0x00, uplink.header, 2);
+                crc = ttc_crc8_update(crc, uplink.payload, uplink.header[1]);
+                if (crc == byte) {
+                    frames_received++;
+                    ttc_handle_command(uplink.header[0], uplink.payload, uplink.header[1]);
+                } else {
+                    fast_rules_crc_error();
+                }
+                uplink.state = UPLINK_WAIT_SYNC;
+                break;
+            }
+        }
+    }
+}
+
+// Internal loopback: in half-duplex mode the USART receives what it
+// sends. The pattern also goes out on the TX line, without a sync byte,
+// so the ground discards it. Scheduler suspended so no task transmits
+// meanwhile; the HAL timeouts keep counting.
+uint8_t ttc_loopback_test(uint32_t *echoed) {
+    static const uint8_t pattern[] = {0x55, 0x33, 0x0F, 0xF0};
+    uint8_t passed = 1;
+
+    *echoed = 0;
+
+    vTaskSuspendAll();
+
+    if (huart1.gState != HAL_UART_STATE_READY) {
+        xTaskResumeAll();
+        return 0;
+    }
+
+    HAL_UART_AbortReceive(&huart1);
+    if (HAL_HalfDuplex_Init(&huart1) != HAL_OK) {
+        passed = 0;
+    }
+
+    for (uint32_t i = 0; passed && i < sizeof(pattern); i++) {
+        uint8_t echo = 0;
+
+        if (HAL_UART_Transmit(&huart1, (uint8_t *)&pattern[i], 1, 2) != HAL_OK ||
+            HAL_UART_Receive(&huart1, &echo, 1, 2) != HAL_OK ||
+            echo != pattern[i]) {
+            passed = 0;
+        } else {
+            (*echoed)++;
+        }
+    }
+
+    // Back to full duplex (clears HDSEL) and re-arm the uplink
+    if (HAL_UART_Init(&huart1) != HAL_OK) {
+        passed = 0;
+    }
+    ttc_start_reception();
+
+    xTaskResumeAll();
+    return passed;
+}
+
+// Frames the payload already at tx_buffer[3]
+static void ttc_transmit_frame(uint8_t frame_id, uint8_t length) {
+    ttc_handle.tx_buffer[0] = TTC_SYNC_BYTE;
+    ttc_handle.tx_buffer[1] = frame_id;
+    ttc_handle.tx_buffer[2] = length;
+    ttc_handle.tx_buffer[3 + length] = ttc_crc8_update(0x00, &ttc_handle.tx_buffer[1], length + 2);
+
+    HAL_UART_Transmit(&huart1, ttc_handle.tx_buffer, length + TTC_FRAME_OVERHEAD, 1000);
+}
+
+void ttc_send_frame(uint8_t frame_id, const uint8_t *payload, uint8_t length) {
+    if (length > TTC_FRAME_MAX_PAYLOAD) {
+        length = TTC_FRAME_MAX_PAYLOAD;
+    }
+
+    memcpy(&ttc_handle.tx_buffer[3], payload, length);
+    ttc_transmit_frame(frame_id, length);
+}
+
+// The report is built straight into the transmit buffer
+void ttc_send_report(uint8_t frame_id, ttc_report_builder_t build) {
+    uint16_t length = build(&ttc_handle.tx_buffer[3], TTC_FRAME_MAX_PAYLOAD);
+
+    if (length > 0) {
+        ttc_transmit_frame(frame_id, (uint8_t)length);
+    }
+}
+
+uint8_t *ttc_put_u16(uint8_t *buffer, uint32_t value) {
+    if (value > UINT16_MAX) {
+        value = UINT16_MAX;
+    }
+    buffer[0] = (uint8_t)(value & 0xFF);
+    buffer[1] = (uint8_t)(value >> 8);
+    return buffer + 2;
+}
+
+uint8_t *ttc_put_u32(uint8_t *buffer, uint32_t value) {
+    buffer[0] = (uint8_t)(value & 0xFF);
+    buffer[1] = (uint8_t)((value >> 8) & 0xFF);
+    buffer[2] = (uint8_t)((value >> 16) & 0xFF);
+    buffer[3] = (uint8_t)((value >> 24) & 0xFF);
+    return buffer + 4;
+}
+
+uint32_t ttc_get_u32(const uint8_t *buffer) {
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) |
+           ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
 uint8_t ttc_check_connection(void) {
     uint32_t current_time = osKernelGetTickCount();
     
@@ -51,16 +339,57 @@ uint8_t ttc_check_connection(void) {
     return 1;
 }
 
+// Running count for the feature engine; read from another task, a
+// single aligned word
+uint32_t ttc_frames_received(void) {
+    return frames_received;
+}
+
+void ttc_request_link_restart(void) {
+    taskENTER_CRITICAL();
+    recovery_pending |= TTC_RECOVER_RESTART;
+    taskEXIT_CRITICAL();
+}
+
+void ttc_request_retransmission(void) {
+    taskENTER_CRITICAL();
+    recovery_pending |= TTC_RECOVER_RETRANSMIT;
+    taskEXIT_CRITICAL();
+}
+
+static void ttc_service_recovery(void) {
+    taskENTER_CRITICAL();
+    uint8_t pending = recovery_pending;
+    recovery_pending = 0;
+    taskEXIT_CRITICAL();
+
+    if (pending & TTC_RECOVER_RESTART) {
+        restart_uart_link();
+    }
+    if (pending & TTC_RECOVER_RETRANSMIT) {
+        request_data_retransmission();
+    }
+}
+
 void ttc_monitor_task(void *argument) {
     ttc_communication_init();
+
+    // First frame after boot: why the previous run ended
+    const crash_context_t *boot_report = crash_context_get_boot_report();
+    ttc_send_frame(TTC_FRAME_RESET_REPORT, (const uint8_t *)boot_report, sizeof(*boot_report));
     
     // Telemetry transmission counter
     uint32_t telemetry_counter = 0;
+    uint32_t last_stats_sample = osKernelGetTickCount();
     
     for(;;) {
+        // Link recovery the fault handler requested, between transmissions
+        ttc_service_recovery();
+
         // Check TTC connection health
-        if (!ttc_check_connection()) {
-            // TTC connection lost - trigger fault
+        if (!ttc_check_connection() && !fast_rules_claimed(3)) {
+            // TTC connection lost - trigger fault, unless the receiver
+            // timeout already did
             ml_result_t fault = {
                 .predicted_class = 3, // TTC fault
                 .confidence = 0.9f,
@@ -69,12 +398,32 @@ void ttc_monitor_task(void *argument) {
             osMessageQueuePut(faultQueueHandle, &fault, 0, 0);
         }
         
+        // Per-task CPU and stack figures, also used as ML features
+        if ((osKernelGetTickCount() - last_stats_sample) >= RUNTIME_STATS_SAMPLE_PERIOD_MS) {
+            runtime_stats_sample();
+            last_stats_sample = osKernelGetTickCount();
+        }
+
+        // Drop back to the monitoring clock once no anomaly is pending
+        clock_mode_service();
+
         // Send periodic telemetry (every 5 seconds)
         if (telemetry_counter++ >= 50) { // 50 * 100ms = 5 seconds
             send_telemetry_data();
             telemetry_counter = 0;
         }
-        
+
+        // Downlink a held black-box capture a few frames at a time
+        blackbox_service_downlink();
+
+        // Ground commands received since the last pass
+        ttc_process_uplink();
+
+        // Adaptation record the last label asked for, or the log's spare
+        // sector erased ahead of need
+        ml_adaptation_service();
+
+        task_health_checkin(TASK_HEALTH_TTC_MONITOR);
         osDelay(100); // 10Hz monitoring
     }
 }
@@ -89,19 +438,71 @@ void send_telemetry_data(void) {
     
     // Add more telemetry data as needed
     ttc_transmit_data(telemetry, sizeof(telemetry));
+
+    // Per-task loop periods, for spotting starvation and priority problems
+    ttc_send_report(TTC_FRAME_TASK_HEALTH, task_health_build_report);
+
+    // CPU share and stack headroom of every task
+    ttc_send_report(TTC_FRAME_RUNTIME_STATS, runtime_stats_build_report);
+
+    // Inference and ISR cycle counts, tagged with the memory placement
+    ttc_send_report(TTC_FRAME_PERF_BENCH, perf_bench_build_report);
+
+    // Sleep residency, STOP wake latency and missed deadlines
+    ttc_send_report(TTC_FRAME_POWER_STATS, low_power_build_report);
+
+    // Clock profile residency and switch cost
+    ttc_send_report(TTC_FRAME_CLOCK_MODE, clock_mode_build_report);
+
+    // When each startup step finished, and whether detection made budget
+    ttc_send_report(TTC_FRAME_BOOT_TIMELINE, boot_timeline_build_report);
+
+    // Latest self test, from boot or the last uplink request
+    ttc_send_report(TTC_FRAME_BIST_REPORT, bist_build_report);
+
+    // How often the anomaly gate let the classifier sleep, and what it saved
+    ttc_send_report(TTC_FRAME_ML_CASCADE, ml_cascade_build_report);
+
+    // Isolation forest: novel samples, its cost and its flash footprint
+    ttc_send_report(TTC_FRAME_NOVELTY, novelty_monitor_build_report);
+
+    // Which weights run, and the state of both update slots
+    ttc_send_report(TTC_FRAME_MODEL_UPDATE, model_update_build_report);
+
+    // Faults waiting for a ground label, and how far gemm_2 has moved
+    ttc_send_report(TTC_FRAME_ML_ADAPTATION, ml_adaptation_build_report);
+
+    // Interrupt rules against the network, reaction time per fault class
+    ttc_send_report(TTC_FRAME_FAST_RULES, fast_rules_build_report);
+
+    // Classifier runs the inference cache answered, and what that saved
+    ttc_send_report(TTC_FRAME_ML_CACHE, ml_cache_build_report);
+
+    // What the model loader bound, where, and how long it took
+    ttc_send_report(TTC_FRAME_ML_MODEL, ml_model_build_report);
 }
 
-void restart_uart_link(void) {
+// From ttc_monitor_task only, between transmissions
+static void restart_uart_link(void) {
     // Re-initialize UART interface
     HAL_UART_DeInit(&huart1);
     osDelay(100);
     HAL_UART_Init(&huart1);
-    
-    // Restart reception
-    ttc_communication_init();
+
+    // Start the ring over with the RX interrupt masked, and the parser
+    // with it. The frame count and the TX buffer are left alone.
+    uplink.state = UPLINK_WAIT_SYNC;
+    HAL_NVIC_DisableIRQ(USART1_IRQn);
+    ttc_handle.rx_index = 0;
+    ttc_handle.rx_read_index = 0;
+    ttc_handle.last_rx_time = osKernelGetTickCount();
+    ttc_handle.connection_healthy = 1;
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
+
+    ttc_start_reception();
 }
 
-void request_data_retransmission(void) {
+static void request_data_retransmission(void) {
     uint8_t retransmit_cmd[4] = {0x55, 0xAA, 0x01, 0x00}; // Example command
     ttc_transmit_data(retransmit_cmd, sizeof(retransmit_cmd));
 }
\ No newline at end of file
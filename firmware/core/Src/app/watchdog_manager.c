@@ -1,10 +1,15 @@
 #include "watchdog_manager.h"
 #include "cmsis_os.h"
 #include "main.h"  // Add this for system_reset and other definitions
+#include "crash_context.h"
+#include "reset_control.h"
+#include "task_health.h"
+#include "memory_map.h"
 
 // TPL5010 Watchdog management
 static uint32_t last_watchdog_ping = 0;
 static uint8_t watchdog_initialized = 0;
+static uint8_t watchdog_starved_mask = 0;
 
 // External variables
 extern reset_control_t system_reset;  // Defined in main.c
@@ -30,9 +35,10 @@ void watchdog_manager_init(void) {
     GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
     HAL_GPIO_Init(WDOG_WAKE_PORT, &GPIO_InitStruct);
     
-    // Initialize watchdog done pin as input
+    // Watchdog done pin keeps its rising-edge EXTI so a timeout reaches
+    // the reset arbiter even when this task is the one that hung
     GPIO_InitStruct.Pin = WDOG_DONE_PIN;
-    GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
     GPIO_InitStruct.Pull = GPIO_NOPULL;
     HAL_GPIO_Init(WDOG_DONE_PORT, &GPIO_InitStruct);
     
@@ -41,6 +47,7 @@ void watchdog_manager_init(void) {
     
     watchdog_initialized = 1;
     last_watchdog_ping = osKernelGetTickCount();
+    task_health_init();
 }
 
 void watchdog_manager_task(void *argument) {
@@ -49,18 +56,30 @@ void watchdog_manager_task(void *argument) {
     }
     
     TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(500); // 2Hz update
+    const TickType_t xFrequency = pdMS_TO_TICKS(WATCHDOG_KICK_INTERVAL_MS);
     
     for(;;) {
-        // Toggle WDOG_WAKE pin to keep watchdog alive
-        HAL_GPIO_TogglePin(WDOG_WAKE_PORT, WDOG_WAKE_PIN);
-        last_watchdog_ping = xTaskGetTickCount();
+        uint8_t stale_mask = 0;
+
+        // Only kick the TPL5010 while every critical task is checking in;
+        // a hung task lets it time out and reset the board
+        if (task_health_all_fresh(&stale_mask)) {
+            HAL_GPIO_TogglePin(WDOG_WAKE_PORT, WDOG_WAKE_PIN);
+            last_watchdog_ping = xTaskGetTickCount();
+            watchdog_starved_mask = 0;
+        } else if (stale_mask != watchdog_starved_mask) {
+            // Record which tasks starved the watchdog before it bites
+            crash_context_note_reset(CRASH_REASON_WATCHDOG_STARVED, stale_mask);
+            watchdog_starved_mask = stale_mask;
+        }
+
+        // Keep the retained state fresh in case the next reset is unannounced
+        crash_context_checkpoint();
         
         // Check if watchdog has timed out (WDOG_DONE pin high indicates timeout)
         if (watchdog_check_timeout()) {
             // Watchdog timeout detected - trigger system reset
-            system_reset.watchdog_reset = 1;
-            // You might want to log this or take additional action
+            reset_control_request(RESET_SRC_WATCHDOG);
         }
         
         vTaskDelayUntil(&xLastWakeTime, xFrequency);
@@ -79,7 +98,8 @@ void watchdog_trigger_reset(void) {
         // Stop the watchdog keepalive by not toggling the pin
         // The watchdog will timeout and reset the system
         // You might want to set a flag or take other actions before reset
-        system_reset.watchdog_reset = 1;
+        crash_context_note_reset(CRASH_REASON_WATCHDOG_STARVED, 0);
+        reset_control_request(RESET_SRC_WATCHDOG);
     }
 }
 
@@ -89,4 +109,14 @@ uint32_t watchdog_get_time_since_last_ping(void) {
         return osKernelGetTickCount() - last_watchdog_ping;
     }
     return 0;
-}
\ No newline at end of file
+}
+
+// For flash_write_erase, from ITCM with every task parked and flash
+// busy: one WAKE toggle, as long as the last health check passed. A task
+// that was already stale keeps the TPL5010 starved through the erase.
+ITCM_FUNC void watchdog_manager_kick_parked(void) {
+    if (watchdog_initialized && watchdog_starved_mask == 0) {
+        uint32_t odr = WDOG_WAKE_PORT->ODR;
+        WDOG_WAKE_PORT->BSRR = ((odr & WDOG_WAKE_PIN) << 16) | (~odr & WDOG_WAKE_PIN);
+    }
+}
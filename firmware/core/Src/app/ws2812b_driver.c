@@ -1,11 +1,21 @@
 #include "ws2812b_driver.h"
 #include "string.h"
-#include "math.h"  // Add for sinf function
 #include "cmsis_os.h"
+#include "memory_map.h"
+#include "ws2812b_encode.h"
 
 static TIM_HandleTypeDef *ws2812b_tim = NULL;
 static uint32_t ws2812b_channel = 0;
-static uint16_t pwm_buffer[24 * 3 + 100]; // Buffer for 3 LEDs + reset
+static uint32_t ws2812b_timer_hz = WS2812B_DEFAULT_TIMER_HZ;
+static ws2812b_lut_t ws2812b_lut;
+
+// Two frames: DMA streams the front one while the next is written to the
+// back one. The zero slots at the end of each frame are the reset period.
+static uint16_t frames[2][WS2812B_FRAME_SLOTS] DMA_BUFFER;
+static volatile uint8_t front_frame = 0;
+static volatile uint8_t dma_busy = 0;
+static volatile uint8_t frame_pending = 0;
+static volatile uint32_t frames_superseded = 0;
 
 const ws2812b_color_t COLOR_NORMAL = {0, 255, 0};        // Green
 const ws2812b_color_t COLOR_ML_ACTIVE = {0, 0, 255};     // Blue
@@ -17,113 +27,121 @@ const ws2812b_color_t COLOR_BOOT = {255, 255, 255};      // White
 const ws2812b_color_t COLOR_CYAN = {0, 255, 255};        // Cyan
 const ws2812b_color_t COLOR_ORANGE = {255, 165, 0};      // Orange
 
+static void ws2812b_rebuild_lut(uint32_t timer_hz) {
+    ws2812b_lut_t lut;
 
-static void color_to_pwm_buffer(ws2812b_color_t color, uint16_t *buffer) {
-    uint32_t grb = ((uint32_t)color.green << 16) | 
-                   ((uint32_t)color.red << 8) | 
-                   color.blue;
-    
-    for(int i = 0; i < 24; i++) {
-        if(grb & (1 << (23 - i))) {
-            buffer[i] = NS_TO_CYCLES(T1H); // Bit 1
-        } else {
-            buffer[i] = NS_TO_CYCLES(T0H); // Bit 0
-        }
-    }
+    ws2812b_encode_build_lut(&lut, (uint16_t)NS_TO_CYCLES(T0H, timer_hz),
+                             (uint16_t)NS_TO_CYCLES(T1H, timer_hz));
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    ws2812b_lut = lut;
+    __set_PRIMASK(primask);
+}
+
+static void ws2812b_start_frame(uint8_t frame) {
+    HAL_TIM_PWM_Start_DMA(ws2812b_tim, ws2812b_channel, (uint32_t *)frames[frame],
+                          WS2812B_FRAME_SLOTS);
 }
 
 void ws2812b_init(TIM_HandleTypeDef *htim, uint32_t channel) {
     ws2812b_tim = htim;
     ws2812b_channel = channel;
-    
-    // Initialize buffer with reset condition
-    memset(pwm_buffer, 0, sizeof(pwm_buffer));
-    
-    // Start the timer
+
+    // Reset tails stay zero for good; frames only rewrite the LED slots
+    memset(frames, 0, sizeof(frames));
+    front_frame = 0;
+    dma_busy = 0;
+    frame_pending = 0;
+
+    ws2812b_set_timer_clock(ws2812b_timer_hz);
+}
+
+void ws2812b_set_timer_clock(uint32_t timer_hz) {
+    ws2812b_timer_hz = timer_hz;
+    ws2812b_rebuild_lut(timer_hz);
+
+    // One bit lasts T0H + T0L whatever the clock profile
     if (ws2812b_tim != NULL) {
-        HAL_TIM_PWM_Start(ws2812b_tim, ws2812b_channel);
+        __HAL_TIM_SET_AUTORELOAD(ws2812b_tim, NS_TO_CYCLES(T0H + T0L, timer_hz) - 1);
     }
 }
 
 void ws2812b_set_color(ws2812b_color_t color) {
-    if (ws2812b_tim == NULL) return;
-    
-    // Convert color to PWM buffer for first LED, others off
-    color_to_pwm_buffer(color, pwm_buffer);
-    
-    // Set remaining LEDs to off
-    ws2812b_color_t off = {0, 0, 0};
-    for(int i = 1; i < 3; i++) {
-        color_to_pwm_buffer(off, &pwm_buffer[i * 24]);
-    }
-    
-    // Send data
-    HAL_TIM_PWM_Start_DMA(ws2812b_tim, ws2812b_channel, (uint32_t*)pwm_buffer, 24 * 3);
-    
-    // Reset condition
-    osDelay(1); // >50us reset
+    // First LED only, the others off
+    ws2812b_color_t leds[WS2812B_NUM_LEDS] = {color};
+    ws2812b_set_colors(leds, WS2812B_NUM_LEDS);
 }
 
+// Non-blocking: queues the frame and returns. If a frame is already
+// waiting behind the one on the wire it is replaced - only the latest
+// state matters for a status LED.
 void ws2812b_set_colors(ws2812b_color_t *colors, uint16_t num_leds) {
-    if (ws2812b_tim == NULL || num_leds == 0) return;
-    
-    uint16_t buffer_size = num_leds * 24;
-    if (buffer_size > sizeof(pwm_buffer)) {
-        buffer_size = sizeof(pwm_buffer); // Prevent overflow
-    }
-    
-    uint16_t *buffer = pwm_buffer;
-    
-    for(int i = 0; i < num_leds && i < 3; i++) { // Max 3 LEDs
-        color_to_pwm_buffer(colors[i], buffer);
-        buffer += 24;
+    uint16_t slots[WS2812B_DATA_SLOTS];
+    uint8_t start = 0;
+
+    if (ws2812b_tim == NULL) return;
+
+    if (num_leds > WS2812B_NUM_LEDS) {
+        num_leds = WS2812B_NUM_LEDS;
     }
-    
-    ws2812b_color_t off = {0, 0, 0};
-    for(int i = num_leds; i < 3; i++) {
-        color_to_pwm_buffer(off, buffer);
-        buffer += 24;
+
+    // Encode outside the critical section
+    memset(slots, 0, sizeof(slots));
+    for (int i = 0; i < WS2812B_NUM_LEDS; i++) {
+        ws2812b_color_t color = (i < num_leds) ? colors[i] : (ws2812b_color_t){0, 0, 0};
+        ws2812b_encode_led(&ws2812b_lut, color.red, color.green, color.blue,
+                           &slots[i * WS2812B_BITS_PER_LED]);
     }
-    
-    HAL_TIM_PWM_Start_DMA(ws2812b_tim, ws2812b_channel, (uint32_t*)pwm_buffer, 24 * 3);
-    osDelay(1); // Reset condition
-}
 
-void ws2812b_chase_pattern(ws2812b_color_t color, uint16_t num_cycles) {
-    if (ws2812b_tim == NULL) return;
-    
-    ws2812b_color_t leds[3] = {0}; 
-    
-    for(int cycle = 0; cycle < num_cycles; cycle++) {
-        for(int pos = 0; pos < 3; pos++) {
-            // Clear all LEDs
-            memset(leds, 0, sizeof(leds));
-            // Set current position
-            leds[pos] = color;
-            
-            ws2812b_set_colors(leds, 3);
-            osDelay(100);
+    // PRIMASK rather than a kernel critical section: this also runs
+    // before the scheduler starts
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint8_t back = front_frame ^ 1U;
+    memcpy(frames[back], slots, sizeof(slots));
+    if (dma_busy) {
+        if (frame_pending) {
+            frames_superseded++;
         }
+        frame_pending = 1;
+    } else {
+        front_frame = back;
+        dma_busy = 1;
+        start = 1;
+    }
+
+    __set_PRIMASK(primask);
+
+    if (start) {
+        ws2812b_start_frame(back);
     }
 }
 
-void ws2812b_breathe_pattern(ws2812b_color_t color, uint16_t duration_ms) {
-    if (ws2812b_tim == NULL) return;
-    
-    uint16_t steps = duration_ms / 20;
-    if (steps == 0) steps = 1;
-    
-    for(int i = 0; i < steps; i++) {
-        float intensity = (1.0f + sinf(2.0f * 3.14159f * i / steps)) / 2.0f;
-        
-        ws2812b_color_t breathe_color = {
-            .red = (uint8_t)(color.red * intensity),
-            .green = (uint8_t)(color.green * intensity),
-            .blue = (uint8_t)(color.blue * intensity)
-        };
-        
-        ws2812b_set_color(breathe_color);
-        osDelay(20);
+uint8_t ws2812b_is_busy(void) {
+    return dma_busy;
+}
+
+uint32_t ws2812b_frames_superseded(void) {
+    return frames_superseded;
+}
+
+// DMA has handed the last slot to the timer: the line is in the reset
+// period, so the next frame can follow straight away
+ITCM_FUNC void HAL_TIM_PWM_PulseFinishedCallback(TIM_HandleTypeDef *htim) {
+    if (htim != ws2812b_tim) {
+        return;
+    }
+
+    HAL_TIM_PWM_Stop_DMA(ws2812b_tim, ws2812b_channel);
+
+    if (frame_pending) {
+        frame_pending = 0;
+        front_frame ^= 1U;
+        ws2812b_start_frame(front_frame);
+    } else {
+        dma_busy = 0;
     }
 }
 
@@ -131,6 +149,6 @@ void ws2812b_set_simple_color(ws2812b_color_t color) {
     if (ws2812b_tim == NULL) return;
     
     // Set all 3 LEDs to the same color
-    ws2812b_color_t leds[3] = {color, color, color};
-    ws2812b_set_colors(leds, 3);
+    ws2812b_color_t leds[WS2812B_NUM_LEDS] = {color, color, color};
+    ws2812b_set_colors(leds, WS2812B_NUM_LEDS);
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "ws2812b_encode.h"
+#include <string.h>
+
+void ws2812b_encode_build_lut(ws2812b_lut_t *lut, uint16_t zero_high, uint16_t one_high) {
+    for (int value = 0; value < 16; value++) {
+        uint16_t pulses[4];
+
+        for (int bit = 0; bit < 4; bit++) {
+            pulses[bit] = (value & (0x8 >> bit)) ? one_high : zero_high;
+        }
+        memcpy(&lut->nibble[value], pulses, sizeof(pulses));
+    }
+}
+
+static inline void encode_byte(const ws2812b_lut_t *lut, uint8_t value, uint16_t *slots) {
+    memcpy(&slots[0], &lut->nibble[value >> 4], sizeof(uint64_t));
+    memcpy(&slots[4], &lut->nibble[value & 0x0F], sizeof(uint64_t));
+}
+
+void ws2812b_encode_led(const ws2812b_lut_t *lut, uint8_t red, uint8_t green, uint8_t blue,
+                        uint16_t *slots) {
+    // WS2812B wire order is GRB
+    encode_byte(lut, green, &slots[0]);
+    encode_byte(lut, red, &slots[8]);
+    encode_byte(lut, blue, &slots[16]);
+}
@@ -49,8 +49,9 @@ DEF_DATA_IN
 DEF_DATA_OUT
 /* Activations buffers -------------------------------------------------------*/
 
+/* Shared by every registered network, sized for the largest */
 AI_ALIGNED(32)
-static uint8_t pool0[AI_NETWORK_DATA_ACTIVATION_1_SIZE];
+static uint8_t pool0[AI_MNETWORK_DATA_ACTIVATIONS_INT_SIZE];
 
 ai_handle data_activations0[] = {pool0};
 
@@ -82,12 +83,15 @@ static const ai_network_entry_t networks[AI_MNETWORK_NUMBER] = {
         .config = AI_NETWORK_DATA_CONFIG,
         .ai_get_report = ai_network_get_report,
         .ai_create = ai_network_create,
+        .ai_create_and_init = ai_network_create_and_init,
         .ai_destroy = ai_network_destroy,
         .ai_get_error = ai_network_get_error,
         .ai_init = ai_network_init,
         .ai_run = ai_network_run,
         .ai_forward = ai_network_forward,
         .ai_data_params_get = ai_network_data_params_get,
+        .ai_inputs_get = ai_network_inputs_get,
+        .ai_outputs_get = ai_network_outputs_get,
         .activations = data_activations0
     },
 };
@@ -193,6 +197,47 @@ ai_error ai_mnetwork_create(const char *name, ai_handle* network,
     return err;
 }
 
+AI_API_ENTRY
+ai_error ai_mnetwork_create_and_init(const char *name, ai_handle* network,
+        const ai_handle weights[])
+{
+    const ai_network_entry_t *entry;
+    const ai_network_entry_t *found = NULL;
+    ai_handle handle = AI_HANDLE_NULL;
+    ai_error err;
+    struct network_instance *inst = ai_mnetwork_handle(NULL);
+
+    if (!inst) {
+        err.type = AI_ERROR_ALLOCATION_FAILED;
+        err.code = AI_ERROR_CODE_NETWORK;
+        return err;
+    }
+
+    for (int i=0; i<AI_MNETWORK_NUMBER; i++) {
+        entry = &networks[i];
+        if (ai_mnetwork_is_valid(name, entry)) {
+            found = entry;
+            break;
+        }
+    }
+
+    if (!found) {
+        err.type = AI_ERROR_INVALID_PARAM;
+        err.code = AI_ERROR_CODE_NETWORK;
+        return err;
+    }
+
+    err = found->ai_create_and_init(&handle, found->activations, weights);
+    /* Created but not bound still needs destroying */
+    if (handle != AI_HANDLE_NULL) {
+        inst->entry = found;
+        inst->handle = handle;
+        *network = (ai_handle*)inst;
+    }
+
+    return err;
+}
+
 AI_API_ENTRY
 ai_handle ai_mnetwork_destroy(ai_handle network)
 {
@@ -251,6 +296,46 @@ ai_bool ai_mnetwork_init(ai_handle network)
         return false;
 }
 
+AI_API_ENTRY
+ai_bool ai_mnetwork_init_weights(ai_handle network, const ai_handle weights[])
+{
+    struct network_instance *inn;
+    ai_network_params par;
+
+    inn =  ai_mnetwork_handle((struct network_instance *)network);
+    if (inn && inn->entry->ai_data_params_get(&par)) {
+        for (int idx=0; idx < par.map_activations.size; idx++)
+          AI_BUFFER_ARRAY_ITEM_SET_ADDRESS(&par.map_activations, idx, inn->entry->activations[idx]);
+        for (int idx=0; weights && idx < par.map_weights.size; idx++)
+          AI_BUFFER_ARRAY_ITEM_SET_ADDRESS(&par.map_weights, idx, weights[idx]);
+        return inn->entry->ai_init(inn->handle, &par);
+    }
+    else
+        return false;
+}
+
+AI_API_ENTRY
+ai_buffer* ai_mnetwork_inputs_get(ai_handle network, ai_u16 *n_buffer)
+{
+    struct network_instance *inn;
+    inn =  ai_mnetwork_handle((struct network_instance *)network);
+    if (inn)
+        return inn->entry->ai_inputs_get(inn->handle, n_buffer);
+    else
+        return NULL;
+}
+
+AI_API_ENTRY
+ai_buffer* ai_mnetwork_outputs_get(ai_handle network, ai_u16 *n_buffer)
+{
+    struct network_instance *inn;
+    inn =  ai_mnetwork_handle((struct network_instance *)network);
+    if (inn)
+        return inn->entry->ai_outputs_get(inn->handle, n_buffer);
+    else
+        return NULL;
+}
+
 AI_API_ENTRY
 ai_i32 ai_mnetwork_run(ai_handle network, const ai_buffer* input,
         ai_buffer* output)
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""
+Weights for the fused fault_model kernel.
+
+Decodes the float weights from the X-CUBE-AI generated
+core/Src/network_data_params.c, the same values the ST runtime runs, and
+writes them as the per-layer arrays fault_model_kernel.c expects. Rows
+stay in the runtime's [output][input] order so both accumulate every
+output in the same sequence.
+
+Rerun whenever the network is regenerated, e.g.
+    python3 tools/fault_model_kernel.py core/Src/network_data_params.c \\
+        -o core/Src/app/fault_model_weights.c
+"""
+
+import argparse
+import sys
+
+from golden_vector import LAYERS, floats, read_weights
+
+HEADER = """\
+// Generated by tools/fault_model_kernel.py from network_data_params.c -
+// do not edit, rerun the tool when the network is regenerated
+#include "fault_model_kernel.h"
+#include "memory_map.h"
+"""
+
+ARRAY_NAMES = ("hidden1", "hidden2", "output")
+
+
+def c_array(name, values, columns):
+    lines = ["DTCM_DATA float %s[%d] = {" % (name, len(values))]
+    for start in range(0, len(values), columns):
+        row = values[start:start + columns]
+        lines.append("    " + " ".join("%.9ef," % v for v in row))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("params", nargs="?", default="core/Src/network_data_params.c",
+                        help="X-CUBE-AI network_data_params.c")
+    parser.add_argument("-o", "--output", default="core/Src/app/fault_model_weights.c",
+                        help="generated C file (default: %(default)s)")
+    args = parser.parse_args()
+
+    blob = read_weights(args.params)
+    if len(blob) < LAYERS[-1][1] + 4 * LAYERS[-1][2]:
+        sys.exit("weights blob is %d bytes, too short for the fault_model layout" % len(blob))
+
+    sections = [HEADER.rstrip()]
+    for name, (weights_at, bias_at, outputs, inputs, _) in zip(ARRAY_NAMES, LAYERS):
+        weights = floats(blob, weights_at, outputs * inputs)
+        bias = floats(blob, bias_at, outputs)
+        sections.append(c_array("fault_model_%s_weights" % name, weights, inputs))
+        sections.append(c_array("fault_model_%s_bias" % name, bias, 4))
+
+    with open(args.output, "w") as f:
+        f.write("\n\n".join(sections) + "\n")
+
+
+if __name__ == "__main__":
+    main()
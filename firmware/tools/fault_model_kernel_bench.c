@@ -0,0 +1,215 @@
+/*
+ * Host benchmark of the fused fault_model kernel: cost per inference of a
+ * layer-by-layer runtime (layer table, runtime shapes, separate ReLU and
+ * softmax passes, as the X-CUBE-AI runtime dispatches them) against
+ * fault_model_kernel.c, plus a check that both produce bit-identical
+ * outputs and stay within 1e-5 of a double precision reference.
+ *
+ * Build and run from the firmware directory:
+ *     cc -O2 -DMEMORY_MAP_USE_TCM=0 -Icore/Inc/app tools/fault_model_kernel_bench.c \
+ *        core/Src/app/fault_model_kernel.c core/Src/app/fault_model_weights.c \
+ *        -lm -o fault_model_kernel_bench
+ *     ./fault_model_kernel_bench
+ *
+ * Absolute numbers are the host's; the ratio is what carries over. On the
+ * target, perf_bench compares the kernel with the real ST runtime.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "fault_model_kernel.h"
+
+#define VECTORS 1024
+#define ROUNDS 200
+#define REFERENCE_TOLERANCE 1e-5
+
+typedef enum { LAYER_DENSE, LAYER_RELU, LAYER_SOFTMAX } layer_type_t;
+
+typedef struct {
+    layer_type_t type;
+    const float *weights;
+    const float *bias;
+    int outputs;
+    int inputs;
+} layer_t;
+
+static const layer_t layers[] = {
+    {LAYER_DENSE, fault_model_hidden1_weights, fault_model_hidden1_bias,
+     FAULT_MODEL_HIDDEN1, FAULT_MODEL_INPUTS},
+    {LAYER_RELU, NULL, NULL, FAULT_MODEL_HIDDEN1, FAULT_MODEL_HIDDEN1},
+    {LAYER_DENSE, fault_model_hidden2_weights, fault_model_hidden2_bias,
+     FAULT_MODEL_HIDDEN2, FAULT_MODEL_HIDDEN1},
+    {LAYER_RELU, NULL, NULL, FAULT_MODEL_HIDDEN2, FAULT_MODEL_HIDDEN2},
+    {LAYER_DENSE, fault_model_output_weights, fault_model_output_bias,
+     FAULT_MODEL_OUTPUTS, FAULT_MODEL_HIDDEN2},
+    {LAYER_SOFTMAX, NULL, NULL, FAULT_MODEL_OUTPUTS, FAULT_MODEL_OUTPUTS},
+};
+
+#define LAYER_COUNT (sizeof(layers) / sizeof(layers[0]))
+
+// Generic runtime: one pass per layer through ping-pong activation buffers
+static void run_layered(const float *input, float *output) {
+    float buffers[2][FAULT_MODEL_HIDDEN1];
+    const float *in = input;
+    float *out = buffers[0];
+
+    for (unsigned l = 0; l < LAYER_COUNT; l++) {
+        const layer_t *layer = &layers[l];
+        out = (l == LAYER_COUNT - 1) ? output : buffers[l & 1];
+
+        switch (layer->type) {
+            case LAYER_DENSE:
+                for (int o = 0; o < layer->outputs; o++) {
+                    float acc = layer->bias[o];
+                    for (int i = 0; i < layer->inputs; i++) {
+                        acc += layer->weights[o * layer->inputs + i] * in[i];
+                    }
+                    out[o] = acc;
+                }
+                break;
+            case LAYER_RELU:
+                for (int i = 0; i < layer->outputs; i++) {
+                    out[i] = (in[i] > 0.0f) ? in[i] : 0.0f;
+                }
+                break;
+            case LAYER_SOFTMAX: {
+                float peak = in[0];
+                float sum = 0.0f;
+                for (int i = 1; i < layer->outputs; i++) {
+                    if (in[i] > peak) {
+                        peak = in[i];
+                    }
+                }
+                for (int i = 0; i < layer->outputs; i++) {
+                    out[i] = expf(in[i] - peak);
+                    sum += out[i];
+                }
+                for (int i = 0; i < layer->outputs; i++) {
+                    out[i] /= sum;
+                }
+                break;
+            }
+        }
+        in = out;
+    }
+}
+
+static void run_double(const float *input, double *output) {
+    double hidden1[FAULT_MODEL_HIDDEN1];
+    double hidden2[FAULT_MODEL_HIDDEN2];
+    double peak, sum = 0.0;
+
+    for (int o = 0; o < FAULT_MODEL_HIDDEN1; o++) {
+        double acc = fault_model_hidden1_bias[o];
+        for (int i = 0; i < FAULT_MODEL_INPUTS; i++) {
+            acc += (double)fault_model_hidden1_weights[o * FAULT_MODEL_INPUTS + i] * input[i];
+        }
+        hidden1[o] = (acc > 0.0) ? acc : 0.0;
+    }
+    for (int o = 0; o < FAULT_MODEL_HIDDEN2; o++) {
+        double acc = fault_model_hidden2_bias[o];
+        for (int i = 0; i < FAULT_MODEL_HIDDEN1; i++) {
+            acc += (double)fault_model_hidden2_weights[o * FAULT_MODEL_HIDDEN1 + i] * hidden1[i];
+        }
+        hidden2[o] = (acc > 0.0) ? acc : 0.0;
+    }
+    for (int o = 0; o < FAULT_MODEL_OUTPUTS; o++) {
+        double acc = fault_model_output_bias[o];
+        for (int i = 0; i < FAULT_MODEL_HIDDEN2; i++) {
+            acc += (double)fault_model_output_weights[o * FAULT_MODEL_HIDDEN2 + i] * hidden2[i];
+        }
+        output[o] = acc;
+    }
+
+    peak = output[0];
+    for (int i = 1; i < FAULT_MODEL_OUTPUTS; i++) {
+        if (output[i] > peak) {
+            peak = output[i];
+        }
+    }
+    for (int i = 0; i < FAULT_MODEL_OUTPUTS; i++) {
+        output[i] = exp(output[i] - peak);
+        sum += output[i];
+    }
+    for (int i = 0; i < FAULT_MODEL_OUTPUTS; i++) {
+        output[i] /= sum;
+    }
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static float inputs[VECTORS][FAULT_MODEL_INPUTS];
+static float outputs[VECTORS][FAULT_MODEL_OUTPUTS];
+
+int main(void) {
+    uint32_t seed = 1;
+    double worst = 0.0;
+
+    // Standardised features, roughly -2..2
+    for (int v = 0; v < VECTORS; v++) {
+        for (int i = 0; i < FAULT_MODEL_INPUTS; i++) {
+            seed = seed * 1664525UL + 1013904223UL;
+            inputs[v][i] = ((float)(seed >> 8) / 16777216.0f) * 4.0f - 2.0f;
+        }
+    }
+
+    for (int v = 0; v < VECTORS; v++) {
+        float reference[FAULT_MODEL_OUTPUTS];
+        double exact[FAULT_MODEL_OUTPUTS];
+
+        fault_model_kernel_run(inputs[v], outputs[v]);
+        run_layered(inputs[v], reference);
+        run_double(inputs[v], exact);
+
+        if (memcmp(outputs[v], reference, sizeof(reference)) != 0) {
+            printf("fused and layered differ for vector %d\n", v);
+            return 1;
+        }
+        for (int o = 0; o < FAULT_MODEL_OUTPUTS; o++) {
+            double error = fabs(outputs[v][o] - exact[o]);
+            if (error > worst) {
+                worst = error;
+            }
+        }
+    }
+    if (worst > REFERENCE_TOLERANCE) {
+        printf("fused kernel is %.3g from the double reference\n", worst);
+        return 1;
+    }
+
+    double start = now_ns();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int v = 0; v < VECTORS; v++) {
+            run_layered(inputs[v], outputs[v]);
+        }
+    }
+    double layered_ns = (now_ns() - start) / ((double)ROUNDS * VECTORS);
+
+    start = now_ns();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int v = 0; v < VECTORS; v++) {
+            fault_model_kernel_run(inputs[v], outputs[v]);
+        }
+    }
+    double fused_ns = (now_ns() - start) / ((double)ROUNDS * VECTORS);
+
+    // Keep the stores observable
+    float checksum = 0.0f;
+    for (int v = 0; v < VECTORS; v++) {
+        checksum += outputs[v][v % FAULT_MODEL_OUTPUTS];
+    }
+
+    printf("layered      : %7.2f ns/inference\n", layered_ns);
+    printf("fused        : %7.2f ns/inference\n", fused_ns);
+    printf("speed-up     : %7.2fx  (max error %.3g, checksum %.3f)\n",
+           layered_ns / fused_ns, worst, checksum);
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+ * Host run of the feature engine over the training dataset: every
+ * statistic of every channel after every row, printed as little-endian
+ * hex floats for feature_schema.py to compare bit for bit with its own
+ * arithmetic, plus the cost per sample.
+ *
+ * Build and run from the firmware directory:
+ *     cc -O2 -ffp-contract=off -DMEMORY_MAP_USE_TCM=0 -Icore/Inc/app \
+ *        tools/feature_engine_bench.c core/Src/app/feature_engine.c \
+ *        -o feature_engine_bench
+ *     ./feature_engine_bench ../cubesat-fault-predictor/data/cubesat_data.csv > features.txt
+ *     cd ../cubesat-fault-predictor && python3 feature_schema.py --compare ../firmware/features.txt
+ *
+ * Absolute timings are the host's.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "feature_engine.h"
+
+#define MAX_ROWS 100000
+#define ROUNDS 50
+
+static float rows[MAX_ROWS][FEATURE_CHANNEL_COUNT];
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Schema channels are the dataset's leading columns, in order
+static int load_rows(const char *path) {
+    char line[512];
+    int count = 0;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        perror(path);
+        exit(1);
+    }
+
+    fgets(line, sizeof(line), f);   // Header
+    while (count < MAX_ROWS && fgets(line, sizeof(line), f) != NULL) {
+        char *field = line;
+        for (int c = 0; c < FEATURE_CHANNEL_COUNT; c++) {
+            rows[count][c] = strtof(field, &field);
+            if (*field == ',') {
+                field++;
+            }
+        }
+        count++;
+    }
+
+    fclose(f);
+    return count;
+}
+
+static void print_hex(float value) {
+    uint8_t bytes[sizeof(float)];
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    for (unsigned i = 0; i < sizeof(bits); i++) {
+        bytes[i] = (uint8_t)(bits >> (8 * i));
+    }
+    printf("%02x%02x%02x%02x", bytes[0], bytes[1], bytes[2], bytes[3]);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s cubesat_data.csv\n", argv[0]);
+        return 1;
+    }
+
+    int count = load_rows(argv[1]);
+
+    feature_engine_init();
+    for (int r = 0; r < count; r++) {
+        feature_engine_push(rows[r]);
+        for (int c = 0; c < FEATURE_CHANNEL_COUNT; c++) {
+            for (int s = 0; s < FEATURE_STAT_COUNT; s++) {
+                print_hex(feature_engine_stat((feature_channel_t)c, (feature_stat_t)s));
+                putchar((c == FEATURE_CHANNEL_COUNT - 1 && s == FEATURE_STAT_COUNT - 1) ? '\n' : ' ');
+            }
+        }
+    }
+
+    float input[FEATURE_MODEL_INPUTS];
+    volatile float sink = 0.0f;
+    double start = now_ns();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int r = 0; r < count; r++) {
+            feature_engine_push(rows[r]);
+            feature_engine_model_input(input, FEATURE_MODEL_INPUTS);
+            sink += input[0];
+        }
+    }
+    double elapsed = now_ns() - start;
+
+    printf("# %d rows, %d channels, %d arena samples (%u bytes)\n", count,
+           FEATURE_CHANNEL_COUNT, FEATURE_ARENA_SAMPLES, (unsigned)FEATURE_ARENA_BYTES);
+    printf("# push + model inputs: %.1f ns per sample\n", elapsed / ((double)ROUNDS * count));
+    (void)sink;
+    return 0;
+}
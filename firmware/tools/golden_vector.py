@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""
+Golden vector for the built-in self test.
+
+Decodes the float weights from the X-CUBE-AI generated
+core/Src/network_data_params.c, runs the fault_model forward pass
+(dense 16 relu, dense 8 relu, dense 5 softmax) on a fixed input and prints
+the C initialisers used by bist.c.
+
+Rerun whenever the network is regenerated, e.g.
+    python3 tools/golden_vector.py core/Src/network_data_params.c
+"""
+
+import argparse
+import math
+import re
+import struct
+import sys
+
+# Byte offsets and shapes from ai_network_configure_weights in network.c
+LAYERS = (
+    # (weights offset, bias offset, outputs, inputs, activation)
+    (0, 512, 16, 8, "relu"),
+    (576, 1088, 8, 16, "relu"),
+    (1120, 1280, 5, 8, "softmax"),
+)
+
+# Standardised feature vector picked so that no class saturates: every
+# output stays between 0.1 and 0.3, so a corrupted weight or kernel shows
+# up in the softmax instead of vanishing under a 0.9999 winner
+GOLDEN_INPUT = (0.75, -0.25, 0.75, 0.0, 0.0, 0.25, 0.75, 1.25)
+
+WORD = re.compile(r"0x([0-9a-fA-F]{1,16})U")
+
+
+def read_weights(path):
+    """Return the weights blob as little-endian floats, one per 4 bytes."""
+    with open(path) as f:
+        text = f.read()
+
+    start = text.index("s_network_weights_array_u64")
+    end = text.index("};", start)
+    blob = b"".join(struct.pack("<Q", int(word, 16)) for word in WORD.findall(text[start:end]))
+    return blob
+
+
+def floats(blob, offset, count):
+    return struct.unpack_from("<%df" % count, blob, offset)
+
+
+def forward(blob, features):
+    values = list(features)
+
+    for weights_at, bias_at, outputs, inputs, activation in LAYERS:
+        weights = floats(blob, weights_at, outputs * inputs)
+        bias = floats(blob, bias_at, outputs)
+        values = [
+            bias[o] + sum(weights[o * inputs + i] * values[i] for i in range(inputs))
+            for o in range(outputs)
+        ]
+        if activation == "relu":
+            values = [max(0.0, v) for v in values]
+        else:
+            peak = max(values)
+            exps = [math.exp(v - peak) for v in values]
+            total = sum(exps)
+            values = [e / total for e in exps]
+
+    return values
+
+
+def c_floats(values):
+    return ", ".join("%.7ff" % v for v in values)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("params", nargs="?", default="core/Src/network_data_params.c",
+                        help="X-CUBE-AI network_data_params.c")
+    args = parser.parse_args()
+
+    blob = read_weights(args.params)
+    if len(blob) < LAYERS[-1][1] + 4 * LAYERS[-1][2]:
+        sys.exit("weights blob is %d bytes, too short for the fault_model layout" % len(blob))
+
+    expected = forward(blob, GOLDEN_INPUT)
+
+    print("static const float golden_input[BIST_GOLDEN_INPUT_SIZE] = {")
+    print("    %s," % c_floats(GOLDEN_INPUT))
+    print("};")
+    print("static const float golden_output[BIST_GOLDEN_OUTPUT_SIZE] = {")
+    print("    %s," % c_floats(expected))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
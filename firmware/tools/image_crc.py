@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Patch the image CRC-32 checked by the built-in self test into a linked ELF.
+
+bist_image_crc is the last word of the image (the .image_crc section in
+the linker script). This computes zlib.crc32 over the loaded image from
+_simage up to that word, erased gaps filled with 0xFF as they are in
+flash, and writes the result into .image_crc. An unpatched image keeps
+0xFFFFFFFF and its flash CRC test reports SKIPPED.
+
+Run it as a post-build step before generating .bin/.hex, e.g.
+    python3 tools/image_crc.py Debug/CubeSat_ML_Fault_Detector.elf
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+DEFAULT_NM = "arm-none-eabi-nm"
+DEFAULT_OBJCOPY = "arm-none-eabi-objcopy"
+START_SYMBOL = "_simage"
+CRC_SYMBOL = "bist_image_crc"
+
+
+def symbol_addresses(elf, nm, names):
+    """Return {name: address} for the requested symbols."""
+    output = subprocess.run([nm, elf], check=True, capture_output=True, text=True).stdout
+    found = {}
+
+    for line in output.splitlines():
+        parts = line.split()
+        if len(parts) == 3 and parts[2] in names:
+            found[parts[2]] = int(parts[0], 16)
+
+    missing = [name for name in names if name not in found]
+    if missing:
+        sys.exit("%s: missing symbols %s" % (elf, ", ".join(missing)))
+    return found
+
+
+def loaded_image(elf, objcopy):
+    """Return the loadable sections as one flat image from the lowest LMA."""
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "image.bin")
+        subprocess.run([objcopy, "-O", "binary", "--gap-fill", "0xff", elf, path], check=True)
+        with open(path, "rb") as f:
+            return f.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("elf", help="linked firmware ELF, patched in place")
+    parser.add_argument("--nm", default=DEFAULT_NM, help="nm executable (default: %(default)s)")
+    parser.add_argument("--objcopy", default=DEFAULT_OBJCOPY,
+                        help="objcopy executable (default: %(default)s)")
+    args = parser.parse_args()
+
+    symbols = symbol_addresses(args.elf, args.nm, (START_SYMBOL, CRC_SYMBOL))
+    length = symbols[CRC_SYMBOL] - symbols[START_SYMBOL]
+    image = loaded_image(args.elf, args.objcopy)
+
+    # The CRC word closes the image; anything else means the binary does not
+    # start at _simage or something was linked after .image_crc
+    if len(image) != length + 4:
+        sys.exit("image is %d bytes, expected %d up to and including %s"
+                 % (len(image), length + 4, CRC_SYMBOL))
+
+    crc = zlib.crc32(image[:length]) & 0xFFFFFFFF
+
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "image_crc.bin")
+        with open(path, "wb") as f:
+            f.write(struct.pack("<I", crc))
+        subprocess.run([args.objcopy, "--update-section", ".image_crc=" + path, args.elf],
+                       check=True)
+
+    print("%s: CRC-32 0x%08X over %d bytes from 0x%08X"
+          % (args.elf, crc, length, symbols[START_SYMBOL]))
+
+
+if __name__ == "__main__":
+    main()
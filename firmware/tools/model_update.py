@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+Uplink frames for a weights-only model update.
+
+Builds the image a model_update slot holds from a regenerated
+network_data_params.c: the weights blob, then the golden input and the
+output this tool computes for it. The image is only accepted if the
+regenerated network has the same weights size as the one in flight. The
+model_hash comes from network_generate_report.txt. Writes the TTC uplink
+frames (begin, chunks, commit), one per line in hex. Send each frame only
+after the previous TTC_FRAME_MODEL_UPDATE reply, and resend from the
+offset in the reply if a chunk was lost.
+
+    python3 tools/model_update.py new/network_data_params.c \\
+        new/network_generate_report.txt -o update.txt
+"""
+
+import argparse
+import re
+import struct
+import sys
+import zlib
+
+from golden_vector import GOLDEN_INPUT, LAYERS, forward, read_weights
+
+# From core/Inc/app/ttc_communication.h and model_update.h
+SYNC = 0xAA
+CMD_MODEL_BEGIN = 0x41
+CMD_MODEL_CHUNK = 0x42
+CMD_MODEL_COMMIT = 0x43
+UPLINK_MAX_PAYLOAD = 64
+WEIGHTS_SIZE = 1300
+HASH_SIZE = 16
+
+MODEL_HASH = re.compile(r"model_hash\s*:\s*0x([0-9a-fA-F]{32})")
+
+
+def crc8(data):
+    """CRC-8, polynomial 0x07, initial value 0, as ttc_crc8_update."""
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def frame(command, payload):
+    body = bytes([command, len(payload)]) + payload
+    return bytes([SYNC]) + body + bytes([crc8(body)])
+
+
+def read_model_hash(path):
+    with open(path) as f:
+        match = MODEL_HASH.search(f.read())
+    if not match:
+        sys.exit("no model_hash in %s" % path)
+    return bytes.fromhex(match.group(1))
+
+
+def build_image(blob):
+    expected = forward(blob, GOLDEN_INPUT)
+    return (blob + struct.pack("<%df" % len(GOLDEN_INPUT), *GOLDEN_INPUT) +
+            struct.pack("<%df" % len(expected), *expected))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("params", help="regenerated network_data_params.c")
+    parser.add_argument("report", help="its network_generate_report.txt")
+    parser.add_argument("-o", "--output", default="-", help="frame file (default: stdout)")
+    parser.add_argument("--chunk", type=int, default=48,
+                        help="image bytes per chunk frame (default: %(default)s)")
+    args = parser.parse_args()
+
+    if not 0 < args.chunk <= UPLINK_MAX_PAYLOAD - 2:
+        sys.exit("chunk must be 1 to %d bytes" % (UPLINK_MAX_PAYLOAD - 2))
+
+    blob = read_weights(args.params)
+    if len(blob) < WEIGHTS_SIZE or len(blob) - WEIGHTS_SIZE >= 8:
+        sys.exit("weights blob is %d bytes, not the %d of the network in flight"
+                 % (len(blob), WEIGHTS_SIZE))
+    blob = blob[:WEIGHTS_SIZE]
+    if LAYERS[-1][1] + 4 * LAYERS[-1][2] != WEIGHTS_SIZE:
+        sys.exit("golden_vector.LAYERS does not match the weights size")
+
+    image = build_image(blob)
+    image_crc = zlib.crc32(image)
+    model_hash = read_model_hash(args.report)
+
+    frames = [frame(CMD_MODEL_BEGIN, struct.pack("<II", len(image), image_crc) + model_hash)]
+    for offset in range(0, len(image), args.chunk):
+        frames.append(frame(CMD_MODEL_CHUNK, struct.pack("<H", offset) + image[offset:offset + args.chunk]))
+    frames.append(frame(CMD_MODEL_COMMIT, b""))
+
+    out = sys.stdout if args.output == "-" else open(args.output, "w")
+    for f in frames:
+        out.write(f.hex() + "\n")
+    if out is not sys.stdout:
+        out.close()
+
+    print("image %d bytes, CRC-32 0x%08x, model_hash %s, %d frames"
+          % (len(image), image_crc, model_hash.hex(), len(frames)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,93 @@
+/*
+ * Host benchmark of the isolation forest novelty model: cost per sample of
+ * novelty_forest_score on the training data, the flash its tables
+ * take, and how many samples of each class it calls novel.
+ *
+ * Build and run from the firmware directory:
+ *     cc -O2 -DMEMORY_MAP_USE_TCM=0 -Icore/Inc/app tools/novelty_model_bench.c \
+ *        core/Src/app/novelty_model.c core/Src/app/novelty_model_data.c \
+ *        -lm -o novelty_model_bench
+ *     ./novelty_model_bench ../cubesat-fault-predictor/data/cubesat_data.csv
+ *
+ * Absolute numbers are the host's; on the target the same figures come
+ * down in the novelty telemetry frame.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "novelty_model.h"
+
+#define MAX_SAMPLES 8192
+#define CLASSES 5
+#define ROUNDS 50
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static float samples[MAX_SAMPLES][NOVELTY_MODEL_FEATURES];
+static int labels[MAX_SAMPLES];
+
+int main(int argc, char **argv) {
+    const char *path = (argc > 1) ? argv[1] : "../cubesat-fault-predictor/data/cubesat_data.csv";
+    FILE *csv = fopen(path, "r");
+    char header[512];
+    int count = 0;
+    int seen[CLASSES] = {0};
+    int novel[CLASSES] = {0};
+
+    if (csv == NULL || fgets(header, sizeof(header), csv) == NULL) {
+        printf("cannot read %s\n", path);
+        return 1;
+    }
+
+    // Same column order as FEATURES in novelty_model.py, then the label
+    while (count < MAX_SAMPLES) {
+        float *s = samples[count];
+        if (fscanf(csv, "%f,%f,%f,%f,%f,%f,%f,%f,%d", &s[0], &s[1], &s[2], &s[3],
+                   &s[4], &s[5], &s[6], &s[7], &labels[count]) != 9) {
+            break;
+        }
+        if (labels[count] < 0 || labels[count] >= CLASSES) {
+            printf("bad label on row %d\n", count + 2);
+            return 1;
+        }
+        count++;
+    }
+    fclose(csv);
+
+    if (count == 0) {
+        printf("no samples in %s\n", path);
+        return 1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        seen[labels[i]]++;
+        if (novelty_model_is_novel(novelty_forest_score(samples[i]))) {
+            novel[labels[i]]++;
+        }
+    }
+
+    float sink = 0.0f;
+    double start = now_ns();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < count; i++) {
+            sink += novelty_forest_score(samples[i]);
+        }
+    }
+    double sample_ns = (now_ns() - start) / ((double)ROUNDS * count);
+
+    printf("samples      : %d\n", count);
+    printf("tables       : %u trees, %u nodes, %u bytes\n", (unsigned)novelty_model_tree_count,
+           (unsigned)novelty_model_node_count, (unsigned)NOVELTY_MODEL_FLASH_BYTES());
+    printf("cost         : %7.2f ns/sample  (checksum %.1f)\n", sample_ns, sink);
+    for (int c = 0; c < CLASSES; c++) {
+        printf("class %d      : %5.1f %% novel of %d\n", c,
+               seen[c] ? 100.0 * novel[c] / seen[c] : 0.0, seen[c]);
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+RAM budget report for the CubeSat fault detector firmware.
+
+Reads the MEMORY block of the linker script and the symbol table of the
+linked ELF and prints:
+  - used / total bytes for every RAM region
+  - every statically allocated RTOS object (rtos_* symbols in freertos.c)
+  - the largest objects in each RAM region
+
+Run it as a post-build step, e.g.
+    python3 tools/ram_budget.py Debug/CubeSat_ML_Fault_Detector.elf
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from collections import defaultdict
+
+DEFAULT_LINKER_SCRIPT = "STM32H735IGTX_FLASH.ld"
+DEFAULT_NM = "arm-none-eabi-nm"
+RAM_REGIONS = ("ITCMRAM", "DTCMRAM", "RAM_D1", "RAM_D2", "RAM_D3", "RAM_EXEC")
+
+MEMORY_LINE = re.compile(
+    r"^\s*(\w+)\s*\([^)]*\)\s*:\s*ORIGIN\s*=\s*(0x[0-9A-Fa-f]+)\s*,\s*LENGTH\s*=\s*(\d+)\s*([KM]?)",
+)
+
+
+def parse_memory_regions(linker_script):
+    """Return {name: (origin, length)} from the linker script MEMORY block."""
+    regions = {}
+    in_memory = False
+
+    with open(linker_script) as f:
+        for line in f:
+            if line.strip().startswith("MEMORY"):
+                in_memory = True
+                continue
+            if in_memory and line.strip().startswith("}"):
+                break
+            if not in_memory:
+                continue
+
+            match = MEMORY_LINE.match(line)
+            if match:
+                name, origin, length, unit = match.groups()
+                scale = {"": 1, "K": 1024, "M": 1024 * 1024}[unit]
+                regions[name] = (int(origin, 16), int(length) * scale)
+
+    return regions
+
+
+def read_symbols(elf, nm):
+    """Return a list of (address, size, type, name) for sized data symbols."""
+    output = subprocess.run(
+        [nm, "--print-size", "--size-sort", elf],
+        check=True, capture_output=True, text=True,
+    ).stdout
+
+    symbols = []
+    for line in output.splitlines():
+        parts = line.split()
+        if len(parts) != 4:
+            continue
+        address, size, sym_type, name = parts
+        # Data and BSS, plus text so code relocated to ITCM is counted
+        if sym_type.lower() in ("b", "d", "t"):
+            symbols.append((int(address, 16), int(size, 16), sym_type, name))
+
+    return symbols
+
+
+def region_of(address, regions):
+    for name, (origin, length) in regions.items():
+        if origin <= address < origin + length:
+            return name
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="Linked firmware ELF")
+    parser.add_argument("--ld", default=DEFAULT_LINKER_SCRIPT, help="Linker script")
+    parser.add_argument("--nm", default=DEFAULT_NM, help="nm executable")
+    parser.add_argument("--top", type=int, default=10, help="Largest objects listed per region")
+    args = parser.parse_args()
+
+    regions = parse_memory_regions(args.ld)
+    ram_regions = {k: v for k, v in regions.items() if k in RAM_REGIONS}
+    symbols = read_symbols(args.elf, args.nm)
+
+    used = defaultdict(int)
+    per_region = defaultdict(list)
+    rtos_objects = []
+
+    for address, size, sym_type, name in symbols:
+        region = region_of(address, ram_regions)
+        if region is None:
+            continue
+        # Code placed in ITCM counts against ITCM; other text symbols are flash
+        if sym_type.lower() == "t" and region != "ITCMRAM":
+            continue
+        used[region] += size
+        per_region[region].append((size, name))
+        if name.startswith("rtos_") or name.endswith("TaskHandle") or name == "ucHeap":
+            rtos_objects.append((name, size, region))
+
+    print("RAM usage per region")
+    print(f"  {'Region':<10} {'Used':>8} {'Size':>8} {'Use':>6}")
+    for name, (_, length) in ram_regions.items():
+        percent = 100.0 * used[name] / length if length else 0.0
+        print(f"  {name:<10} {used[name]:>8} {length:>8} {percent:>5.1f}%")
+
+    print()
+    print("Static RTOS objects")
+    total = 0
+    for name, size, region in sorted(rtos_objects, key=lambda o: -o[1]):
+        print(f"  {name:<40} {size:>8}  {region}")
+        total += size
+    print(f"  {'total':<40} {total:>8}")
+
+    for name in ram_regions:
+        if not per_region[name]:
+            continue
+        print()
+        print(f"Largest objects in {name}")
+        for size, symbol in sorted(per_region[name], reverse=True)[:args.top]:
+            print(f"  {symbol:<40} {size:>8}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
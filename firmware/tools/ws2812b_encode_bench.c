@@ -0,0 +1,97 @@
+/*
+ * Host benchmark of the WS2812B bit encoder: per-LED cost of the old
+ * per-bit loop against the nibble lookup table in ws2812b_encode.c,
+ * plus a check that both produce the same PWM slots.
+ *
+ * Build and run from the firmware directory:
+ *     cc -O2 -Icore/Inc/app tools/ws2812b_encode_bench.c \
+ *        core/Src/app/ws2812b_encode.c -o ws2812b_encode_bench
+ *     ./ws2812b_encode_bench
+ *
+ * Absolute numbers are the host's; the ratio is what carries over.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ws2812b_encode.h"
+
+#define ZERO_HIGH 28    // T0H at 80 MHz
+#define ONE_HIGH 72     // T1H at 80 MHz
+#define LEDS 4096
+#define ROUNDS 200
+
+// The encoder the driver used before the lookup table
+static void encode_per_bit(uint8_t red, uint8_t green, uint8_t blue, uint16_t *slots) {
+    uint32_t grb = ((uint32_t)green << 16) | ((uint32_t)red << 8) | blue;
+
+    for (int i = 0; i < 24; i++) {
+        if (grb & (1UL << (23 - i))) {
+            slots[i] = ONE_HIGH;
+        } else {
+            slots[i] = ZERO_HIGH;
+        }
+    }
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint8_t colors[LEDS][3];
+static uint16_t slots[LEDS][WS2812B_BITS_PER_LED];
+
+int main(void) {
+    ws2812b_lut_t lut;
+    uint32_t seed = 1;
+    uint16_t reference[WS2812B_BITS_PER_LED];
+
+    ws2812b_encode_build_lut(&lut, ZERO_HIGH, ONE_HIGH);
+
+    for (int i = 0; i < LEDS; i++) {
+        for (int c = 0; c < 3; c++) {
+            seed = seed * 1664525UL + 1013904223UL;
+            colors[i][c] = (uint8_t)(seed >> 24);
+        }
+    }
+
+    for (int i = 0; i < LEDS; i++) {
+        ws2812b_encode_led(&lut, colors[i][0], colors[i][1], colors[i][2], slots[i]);
+        encode_per_bit(colors[i][0], colors[i][1], colors[i][2], reference);
+        if (memcmp(slots[i], reference, sizeof(reference)) != 0) {
+            printf("mismatch at LED %d\n", i);
+            return 1;
+        }
+    }
+
+    double start = now_ns();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LEDS; i++) {
+            encode_per_bit(colors[i][0], colors[i][1], colors[i][2], slots[i]);
+        }
+    }
+    double per_bit_ns = (now_ns() - start) / ((double)ROUNDS * LEDS);
+
+    start = now_ns();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (int i = 0; i < LEDS; i++) {
+            ws2812b_encode_led(&lut, colors[i][0], colors[i][1], colors[i][2], slots[i]);
+        }
+    }
+    double lut_ns = (now_ns() - start) / ((double)ROUNDS * LEDS);
+
+    // Keep the stores observable
+    uint32_t checksum = 0;
+    for (int i = 0; i < LEDS; i++) {
+        checksum += slots[i][i % WS2812B_BITS_PER_LED];
+    }
+
+    printf("per-bit loop : %6.2f ns/LED\n", per_bit_ns);
+    printf("nibble LUT   : %6.2f ns/LED\n", lut_ns);
+    printf("speed-up     : %6.2fx  (checksum %u)\n", per_bit_ns / lut_ns, checksum);
+    return 0;
+}